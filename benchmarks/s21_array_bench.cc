@@ -0,0 +1,39 @@
+#include "s21_array.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+namespace {
+
+constexpr size_t kArraySize = 1 << 14;
+
+template <typename Array>
+void BM_ArrayCopy(benchmark::State &state) {
+  static const Array source{};
+  for (auto _ : state) {
+    Array copy(source);
+    benchmark::DoNotOptimize(copy.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Array));
+}
+
+template <typename Array>
+void BM_ArrayFill(benchmark::State &state) {
+  static Array array;
+  for (auto _ : state) {
+    array.fill(0);
+    benchmark::DoNotOptimize(array.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Array));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ArrayCopy, s21::array<uint64_t, kArraySize>);
+BENCHMARK_TEMPLATE(BM_ArrayCopy, std::array<uint64_t, kArraySize>);
+BENCHMARK_TEMPLATE(BM_ArrayFill, s21::array<uint64_t, kArraySize>);
+BENCHMARK_TEMPLATE(BM_ArrayFill, std::array<uint64_t, kArraySize>);
@@ -0,0 +1,67 @@
+#include "s21_blocking_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int64_t kTasks = 1 << 18;
+
+/*
+ *  Two submitter threads hand kTasks tasks to one worker through a
+ *  bounded queue of state.range(1) slots, 0 for unbounded. The worker
+ *  takes state.range(0) tasks per lock acquisition, batches of 1 use pop.
+ */
+void BM_WorkQueue(benchmark::State &state) {
+  const size_t batch = state.range(0);
+  const size_t capacity = state.range(1);
+  for (auto _ : state) {
+    s21::blocking_queue<int64_t> q(capacity);
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < 2; ++t) {
+      submitters.emplace_back([&q] {
+        for (int64_t i = 0; i < kTasks / 2; ++i) {
+          q.push(i);
+        }
+      });
+    }
+    std::vector<int64_t> tasks(batch);
+    int64_t done = 0;
+    while (done < kTasks) {
+      done += batch == 1 ? q.pop(tasks[0]) : q.pop_batch(tasks.data(), batch);
+    }
+    benchmark::DoNotOptimize(tasks.data());
+    for (std::thread &thread : submitters) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kTasks);
+}
+
+/*
+ *  Cost of a timed pop that finds a task, against a plain pop.
+ */
+void BM_TimedPop(benchmark::State &state) {
+  s21::blocking_queue<int64_t> q;
+  int64_t value = 0;
+  for (auto _ : state) {
+    q.push(value);
+    if (state.range(0) == 0) {
+      q.pop(value);
+    } else {
+      q.try_pop_for(value, std::chrono::milliseconds(1));
+    }
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_WorkQueue)
+    ->ArgsProduct({{1, 16, 64}, {0, 1024}})
+    ->UseRealTime();
+BENCHMARK(BM_TimedPop)->Arg(0)->Arg(1);
@@ -0,0 +1,68 @@
+#include "s21_concurrent_stack.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+#include "s21_stack.h"
+
+namespace {
+
+/*
+ *  The baseline: s21::stack guarded by a mutex.
+ */
+class LockedStack {
+ public:
+  void push(int64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(int64_t &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) {
+      return false;
+    }
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<int64_t> stack_;
+};
+
+template <typename Stack>
+Stack *shared_stack = nullptr;
+
+/*
+ *  A buffer free list: every thread takes a buffer and gives it back.
+ */
+template <typename Stack>
+void BM_FreeList(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    shared_stack<Stack> = new Stack;
+    for (int64_t i = 0; i < 1024; ++i) {
+      shared_stack<Stack>->push(i);
+    }
+  }
+  int64_t buffer = 0;
+  for (auto _ : state) {
+    if (shared_stack<Stack>->try_pop(buffer)) {
+      shared_stack<Stack>->push(buffer);
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete shared_stack<Stack>;
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FreeList, s21::concurrent_stack<int64_t>)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FreeList, LockedStack)->ThreadRange(1, 32)->UseRealTime();
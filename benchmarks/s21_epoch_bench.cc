@@ -0,0 +1,76 @@
+#include "s21_epoch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+struct Node : s21::epoch_hook {
+  int64_t value = 0;
+};
+
+using Domain = s21::epoch_domain<Node>;
+
+Domain *shared_domain = nullptr;
+std::mutex shared_mutex;
+
+/*
+ *  Cost of an empty read-side critical section.
+ */
+void BM_GuardEnterExit(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    shared_domain = new Domain;
+  }
+  for (auto _ : state) {
+    Domain::guard guard(*shared_domain);
+    benchmark::ClobberMemory();
+  }
+  if (state.thread_index() == 0) {
+    delete shared_domain;
+  }
+}
+
+/*
+ *  The same critical section under a mutex.
+ */
+void BM_MutexLockUnlock(benchmark::State &state) {
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    benchmark::ClobberMemory();
+  }
+}
+
+/*
+ *  Allocate a node and retire it, compared with allocate and delete.
+ */
+void BM_GuardRetire(benchmark::State &state) {
+  Domain domain;
+  std::allocator<Node> alloc;
+  for (auto _ : state) {
+    Node *node = alloc.allocate(1);
+    ::new (static_cast<void *>(node)) Node();
+    Domain::guard guard(domain);
+    guard.retire(node);
+  }
+}
+
+void BM_AllocateDelete(benchmark::State &state) {
+  std::allocator<Node> alloc;
+  for (auto _ : state) {
+    Node *node = alloc.allocate(1);
+    ::new (static_cast<void *>(node)) Node();
+    benchmark::DoNotOptimize(node);
+    node->~Node();
+    alloc.deallocate(node, 1);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_GuardEnterExit)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MutexLockUnlock)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_GuardRetire);
+BENCHMARK(BM_AllocateDelete);
@@ -0,0 +1,81 @@
+#include "s21_indexed_heap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "s21_multiset.h"
+
+namespace {
+
+/*
+ *  The pattern the timer code used so far: a multiset of deadlines and
+ *  an iterator per timer, rescheduled by erase and insert.
+ */
+class MultisetTimers {
+ public:
+  size_t add(int64_t deadline) {
+    timers_.push_back(set_.insert(deadline));
+    return timers_.size() - 1;
+  }
+
+  void reschedule(size_t timer, int64_t deadline) {
+    set_.erase(timers_[timer]);
+    timers_[timer] = set_.insert(deadline);
+  }
+
+  int64_t next(void) const { return *set_.begin(); }
+
+ private:
+  s21::multiset<int64_t> set_;
+  std::vector<s21::multiset<int64_t>::iterator> timers_;
+};
+
+template <size_t Arity>
+class HeapTimers {
+ public:
+  size_t add(int64_t deadline) { return heap_.push(0, deadline); }
+
+  void reschedule(size_t timer, int64_t deadline) {
+    heap_.update(timer, deadline);
+  }
+
+  int64_t next(void) const { return heap_.top_priority(); }
+
+ private:
+  s21::indexed_heap<int, int64_t, s21::Less<int64_t>, Arity> heap_;
+};
+
+uint64_t NextRandom(uint64_t &x) {
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  return x;
+}
+
+/*
+ *  state.range(0) connections with idle timeouts; each iteration some
+ *  connection sees traffic and its timeout is moved.
+ */
+template <typename Timers>
+void BM_Reschedule(benchmark::State &state) {
+  const size_t n = state.range(0);
+  uint64_t x = 88172645463325252ULL;
+  Timers timers;
+  for (size_t i = 0; i < n; ++i) {
+    timers.add(NextRandom(x) % 1000000);
+  }
+  for (auto _ : state) {
+    uint64_t r = NextRandom(x);
+    timers.reschedule(r % n, (r >> 32) % 1000000);
+    benchmark::DoNotOptimize(timers.next());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Reschedule, HeapTimers<2>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Reschedule, HeapTimers<4>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Reschedule, MultisetTimers)->Arg(1 << 10)->Arg(1 << 16);
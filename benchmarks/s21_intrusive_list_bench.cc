@@ -0,0 +1,88 @@
+#include "s21_intrusive_list.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "s21_list.h"
+#include "s21_vector.h"
+
+namespace {
+
+struct Timer {
+  int64_t deadline = 0;
+  s21::list_hook hook;
+  s21::list<Timer *>::iterator position;
+};
+
+/*
+ *  Timers of a pool of state.range(0) are rescheduled round robin: each
+ *  iteration unlinks one timer and appends it again. Mode 0 keeps
+ *  pointers in an s21::list, with the node iterator stored in the timer
+ *  for the O(1) erase, mode 1 links the timers themselves.
+ */
+void BM_IntrusiveListReschedule(benchmark::State &state) {
+  const int64_t count = state.range(0);
+  s21::vector<Timer> timers(count);
+  s21::list<Timer *> nodes;
+  s21::intrusive_list<Timer, &Timer::hook> linked;
+  for (Timer &timer : timers) {
+    if (state.range(1) == 0) {
+      nodes.push_back(&timer);
+      timer.position = --nodes.end();
+    } else {
+      linked.push_back(timer);
+    }
+  }
+  int64_t next = 0;
+  for (auto _ : state) {
+    Timer &timer = timers[next];
+    timer.deadline += count;
+    if (state.range(1) == 0) {
+      nodes.erase(timer.position);
+      nodes.push_back(&timer);
+      timer.position = --nodes.end();
+      benchmark::DoNotOptimize(nodes.front()->deadline);
+    } else {
+      linked.erase(timer);
+      linked.push_back(timer);
+      benchmark::DoNotOptimize(linked.front().deadline);
+    }
+    next = next + 1 < count ? next + 1 : 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/*
+ *  Walk the list and sum the deadlines: one indirection per element for
+ *  the pointer list, none for the intrusive one.
+ */
+void BM_IntrusiveListWalk(benchmark::State &state) {
+  s21::vector<Timer> timers(state.range(0));
+  s21::list<Timer *> nodes;
+  s21::intrusive_list<Timer, &Timer::hook> linked;
+  for (Timer &timer : timers) {
+    nodes.push_back(&timer);
+    linked.push_back(timer);
+  }
+  for (auto _ : state) {
+    int64_t sum = 0;
+    if (state.range(1) == 0) {
+      for (const Timer *timer : nodes) {
+        sum += timer->deadline;
+      }
+    } else {
+      for (const Timer &timer : linked) {
+        sum += timer.deadline;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_IntrusiveListReschedule)
+    ->ArgsProduct({{1 << 10, 1 << 18}, {0, 1}});
+BENCHMARK(BM_IntrusiveListWalk)->ArgsProduct({{1 << 10, 1 << 18}, {0, 1}});
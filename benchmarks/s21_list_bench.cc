@@ -0,0 +1,158 @@
+#include "s21_list.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <new>
+#include <random>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace {
+
+int64_t allocations = 0;
+size_t max_bytes = static_cast<size_t>(-1);
+
+/*
+ *  std::allocator that counts its allocate calls and refuses requests
+ *  above max_bytes.
+ */
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = CountingAllocator<U>;
+  };
+
+  CountingAllocator(void) = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    if (n * sizeof(T) > max_bytes) {
+      throw std::bad_alloc();
+    }
+    ++allocations;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
+/*
+ *  A message queue: state.range(0) messages stay queued while each
+ *  iteration appends one and takes the oldest. Mode 0 allocates a node
+ *  per message, mode 1 reserves a pool for the resident messages.
+ */
+void BM_ListFifoChurn(benchmark::State &state) {
+  s21::list<int64_t, CountingAllocator<int64_t>> queue;
+  if (state.range(1) == 1) {
+    queue.reserve_nodes(state.range(0) + 1);
+  }
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    queue.push_back(i);
+  }
+  int64_t next = state.range(0);
+  allocations = 0;
+  for (auto _ : state) {
+    queue.push_back(next++);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop_front();
+  }
+  state.counters["allocs_per_op"] =
+      static_cast<double>(allocations) / state.iterations();
+  state.SetItemsProcessed(state.iterations());
+}
+
+/*
+ *  Build a list of state.range(0) values and clear it again.
+ */
+void BM_ListFillClear(benchmark::State &state) {
+  s21::list<int64_t, CountingAllocator<int64_t>> values;
+  if (state.range(1) == 1) {
+    values.reserve_nodes(state.range(0));
+  }
+  allocations = 0;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      values.push_back(i);
+    }
+    values.clear();
+  }
+  state.counters["allocs_per_op"] = static_cast<double>(allocations) /
+                                    (state.iterations() * state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ *  A queue-depth probe: size() of a list of state.range(0) elements.
+ */
+void BM_ListSize(benchmark::State &state) {
+  s21::list<int64_t> values;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    values.push_back(i);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(values);
+    benchmark::DoNotOptimize(values.size());
+  }
+}
+
+/*
+ *  Queue 256-byte messages built by the producer. Mode 0 copies each
+ *  message into its node, mode 1 moves it and mode 2 builds it there.
+ */
+void BM_ListPushMessage(benchmark::State &state) {
+  s21::list<std::string> queue;
+  for (auto _ : state) {
+    if (state.range(0) == 2) {
+      queue.emplace_back(256, 'm');
+    } else {
+      std::string message(256, 'm');
+      if (state.range(0) == 1) {
+        queue.push_back(std::move(message));
+      } else {
+        queue.push_back(message);
+      }
+    }
+    benchmark::DoNotOptimize(queue.back());
+    queue.pop_front();
+  }
+}
+
+/*
+ *  Sort state.range(1) random values. Mode 0 refuses the pointer buffer,
+ *  so the list falls back to merging the nodes in place, mode 1 sorts
+ *  through the buffer. The values are refilled in list order between
+ *  iterations, so after the first sort the nodes are scattered.
+ */
+void BM_ListSort(benchmark::State &state) {
+  s21::list<int64_t, CountingAllocator<int64_t>> values;
+  std::mt19937_64 random(42);
+  for (int64_t i = 0; i < state.range(1); ++i) {
+    values.push_back(random());
+  }
+  if (state.range(0) == 0) {
+    max_bytes = sizeof(s21::ListNode<int64_t>);
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int64_t &value : values) {
+      value = random();
+    }
+    state.ResumeTiming();
+    values.sort();
+    benchmark::DoNotOptimize(values.front());
+  }
+  max_bytes = static_cast<size_t>(-1);
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ListFifoChurn)->ArgsProduct({{16, 4096}, {0, 1}});
+BENCHMARK(BM_ListFillClear)->ArgsProduct({{1 << 16}, {0, 1}});
+BENCHMARK(BM_ListSize)->Range(16, 1 << 16);
+BENCHMARK(BM_ListPushMessage)->DenseRange(0, 2);
+BENCHMARK(BM_ListSort)
+    ->ArgsProduct({{0, 1}, {10000, 100000, 1000000, 10000000}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,73 @@
+#include "s21_mpmc_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_queue.h"
+
+namespace {
+
+/*
+ *  The baseline: s21::queue guarded by a mutex, with a condition
+ *  variable for pop on an empty queue.
+ */
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t) {}
+
+  void push(int64_t value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    not_empty_.notify_one();
+  }
+
+  void pop(int64_t &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty(); });
+    out = queue_.front();
+    queue_.pop();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  s21::queue<int64_t> queue_;
+};
+
+template <typename Queue>
+Queue *shared_queue = nullptr;
+
+/*
+ *  A worker pool where every thread submits a task and takes one,
+ *  so all threads are producers and consumers at once.
+ */
+template <typename Queue>
+void BM_MpmcPushPop(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    shared_queue<Queue> = new Queue(1024);
+  }
+  int64_t value = 0;
+  for (auto _ : state) {
+    shared_queue<Queue>->push(value);
+    shared_queue<Queue>->pop(value);
+    benchmark::DoNotOptimize(value);
+  }
+  if (state.thread_index() == 0) {
+    delete shared_queue<Queue>;
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MpmcPushPop, s21::mpmc_queue<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcPushPop, LockedQueue)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
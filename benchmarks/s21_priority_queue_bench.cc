@@ -0,0 +1,109 @@
+#include "s21_priority_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "s21_multiset.h"
+#include "s21_vector.h"
+
+namespace {
+
+/*
+ *  The pattern the schedulers used so far: a multiset whose first
+ *  element is the next deadline.
+ */
+class MultisetHeap {
+ public:
+  MultisetHeap(void) = default;
+  MultisetHeap(const int64_t *first, const int64_t *last) {
+    for (; first != last; ++first) {
+      set_.insert(*first);
+    }
+  }
+
+  int64_t top(void) const { return *set_.begin(); }
+  void push(int64_t value) { set_.insert(value); }
+  void pop(void) { set_.erase(set_.begin()); }
+  void pop_push(int64_t value) {
+    pop();
+    push(value);
+  }
+
+ private:
+  s21::multiset<int64_t> set_;
+};
+
+template <size_t Arity>
+using MinHeap = s21::priority_queue<int64_t, s21::vector<int64_t>,
+                                    std::greater<int64_t>, Arity>;
+
+/*
+ *  Pseudo-random timer delays.
+ */
+std::vector<int64_t> Delays(size_t n) {
+  std::vector<int64_t> delays(n);
+  uint64_t x = 88172645463325252ULL;
+  for (int64_t &delay : delays) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    delay = x % 1000000;
+  }
+  return delays;
+}
+
+/*
+ *  A timer wheel: state.range(0) timers are pending, and each iteration
+ *  fires the earliest one and schedules a new one after it. Mode 0 uses
+ *  pop and push, mode 1 uses pop_push.
+ */
+template <typename Heap>
+void BM_TimerSteadyState(benchmark::State &state) {
+  std::vector<int64_t> delays = Delays(state.range(0));
+  Heap heap;
+  for (int64_t delay : delays) {
+    heap.push(delay);
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    int64_t now = heap.top();
+    int64_t next = now + delays[i++ % delays.size()];
+    if (state.range(1) == 0) {
+      heap.pop();
+      heap.push(next);
+    } else {
+      heap.pop_push(next);
+    }
+    benchmark::DoNotOptimize(now);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/*
+ *  Build a heap from state.range(0) timers.
+ */
+template <typename Heap>
+void BM_HeapBuild(benchmark::State &state) {
+  std::vector<int64_t> delays = Delays(state.range(0));
+  for (auto _ : state) {
+    Heap heap(delays.data(), delays.data() + delays.size());
+    benchmark::DoNotOptimize(heap.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_TimerSteadyState, MinHeap<2>)
+    ->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_TimerSteadyState, MinHeap<4>)
+    ->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_TimerSteadyState, MultisetHeap)
+    ->ArgsProduct({{1 << 10, 1 << 16}, {0}});
+
+BENCHMARK_TEMPLATE(BM_HeapBuild, MinHeap<2>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_HeapBuild, MinHeap<4>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_HeapBuild, MultisetHeap)->Arg(1 << 16);
@@ -0,0 +1,109 @@
+#include "s21_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <queue>
+#include <stack>
+#include <type_traits>
+#include <vector>
+
+#include "s21_list.h"
+#include "s21_ring_buffer.h"
+#include "s21_stack.h"
+
+namespace {
+
+/*
+ *  A job scheduler: state.range(0) entries stay queued while
+ *  each iteration pushes one job and pops the oldest.
+ */
+template <typename Queue>
+void BM_QueueSteadyState(benchmark::State &state) {
+  Queue q;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    q.push(i);
+  }
+  int64_t next = state.range(0);
+  for (auto _ : state) {
+    q.push(next++);
+    benchmark::DoNotOptimize(q.front());
+    q.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/*
+ *  Fill a stack with state.range(0) entries and drain it.
+ */
+template <typename Stack>
+void BM_StackFillDrain(benchmark::State &state) {
+  Stack st;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      st.push(i);
+    }
+    while (!st.empty()) {
+      benchmark::DoNotOptimize(st.top());
+      st.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ *  Move batches of state.range(0) values through a queue,
+ *  element by element for mode 0 and with push_n and pop_n for mode 1.
+ */
+template <typename Queue>
+void BM_QueueBatches(benchmark::State &state) {
+  const size_t batch = state.range(0);
+  std::vector<int64_t> in(batch, 1);
+  std::vector<int64_t> out(batch);
+  Queue q;
+  for (auto _ : state) {
+    if constexpr (std::is_same<Queue, s21::ring_queue<int64_t>>::value) {
+      if (state.range(1) == 1) {
+        q.push_n(in.data(), batch);
+        q.pop_n(out.data(), batch);
+        benchmark::DoNotOptimize(out.data());
+        continue;
+      }
+    }
+    for (size_t i = 0; i < batch; ++i) {
+      q.push(in[i]);
+    }
+    for (size_t i = 0; i < batch; ++i) {
+      out[i] = q.front();
+      q.pop();
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+using ListQueue = s21::queue<int64_t, s21::list<int64_t>>;
+using ListStack = s21::stack<int64_t, s21::list<int64_t>>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int64_t>)
+    ->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, ListQueue)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::ring_queue<int64_t>)
+    ->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, std::queue<int64_t>)
+    ->Range(1 << 4, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_QueueBatches, ListQueue)
+    ->ArgsProduct({{16, 256, 4096}, {0}});
+BENCHMARK_TEMPLATE(BM_QueueBatches, s21::queue<int64_t>)
+    ->ArgsProduct({{16, 256, 4096}, {0}});
+BENCHMARK_TEMPLATE(BM_QueueBatches, s21::ring_queue<int64_t>)
+    ->ArgsProduct({{16, 256, 4096}, {0, 1}});
+
+BENCHMARK_TEMPLATE(BM_StackFillDrain, s21::stack<int64_t>)
+    ->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_StackFillDrain, ListStack)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_StackFillDrain, std::stack<int64_t>)
+    ->Range(1 << 4, 1 << 16);
@@ -0,0 +1,70 @@
+#include "s21_small_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "s21_vector.h"
+
+namespace {
+
+size_t allocations = 0;
+
+/*
+ *  Heap allocator that counts calls to allocate.
+ */
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator(void) = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    ++allocations;
+    return static_cast<T *>(operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, size_t) { operator delete(ptr); }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T> &, const CountingAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T> &, const CountingAllocator<U> &) {
+  return false;
+}
+
+/*
+ *  Build many short-lived vectors of state.range(0) elements, the way
+ *  request handlers do, and report heap allocations per vector.
+ */
+template <typename Vector>
+void BM_ShortLived(benchmark::State &state) {
+  allocations = 0;
+  for (auto _ : state) {
+    Vector v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+using Vector = s21::vector<int, CountingAllocator<int>>;
+template <size_t N>
+using SmallVector = s21::small_vector<int, N, CountingAllocator<int>>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ShortLived, Vector)->DenseRange(2, 20, 2);
+BENCHMARK_TEMPLATE(BM_ShortLived, SmallVector<4>)->DenseRange(2, 20, 2);
+BENCHMARK_TEMPLATE(BM_ShortLived, SmallVector<8>)->DenseRange(2, 20, 2);
+BENCHMARK_TEMPLATE(BM_ShortLived, SmallVector<16>)->DenseRange(2, 20, 2);
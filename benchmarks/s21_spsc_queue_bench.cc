@@ -0,0 +1,147 @@
+#include "s21_spsc_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_queue.h"
+
+namespace {
+
+/*
+ *  The baseline: a bounded s21::queue guarded by a mutex.
+ */
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(int64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) {
+      return false;
+    }
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int64_t &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+  size_t try_push_n(const int64_t *values, size_t n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t i = 0;
+    for (; i < n && queue_.size() < capacity_; ++i) {
+      queue_.push(values[i]);
+    }
+    return i;
+  }
+
+  size_t try_pop_n(int64_t *out, size_t n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t i = 0;
+    for (; i < n && !queue_.empty(); ++i) {
+      out[i] = queue_.front();
+      queue_.pop();
+    }
+    return i;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int64_t> queue_;
+  size_t capacity_;
+};
+
+constexpr size_t kCapacity = 1024;
+constexpr int64_t kItems = 1 << 18;
+
+/*
+ *  A network thread hands kItems packets to a parser thread, in batches
+ *  of state.range(0) packets. Batches of 1 use try_push and try_pop.
+ */
+template <typename Queue>
+void BM_SpscThroughput(benchmark::State &state) {
+  const size_t batch = state.range(0);
+  for (auto _ : state) {
+    Queue q(kCapacity);
+    std::thread consumer([&q, batch] {
+      std::vector<int64_t> out(batch);
+      int64_t received = 0;
+      while (received < kItems) {
+        size_t n = batch == 1 ? q.try_pop(out[0])
+                              : q.try_pop_n(out.data(), batch);
+        if (n == 0) {
+          std::this_thread::yield();
+        }
+        received += n;
+      }
+      benchmark::DoNotOptimize(out.data());
+    });
+    std::vector<int64_t> in(batch, 1);
+    int64_t sent = 0;
+    while (sent < kItems) {
+      size_t n = std::min<int64_t>(batch, kItems - sent);
+      n = n == 1 ? q.try_push(in[0]) : q.try_push_n(in.data(), n);
+      if (n == 0) {
+        std::this_thread::yield();
+      }
+      sent += n;
+    }
+    consumer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+/*
+ *  Round trip of one message to an echo thread and back.
+ */
+template <typename Queue>
+void BM_SpscPingPong(benchmark::State &state) {
+  Queue ping(kCapacity);
+  Queue pong(kCapacity);
+  std::thread echo([&ping, &pong] {
+    int64_t value = 0;
+    while (value >= 0) {
+      if (ping.try_pop(value)) {
+        while (!pong.try_push(value)) {
+        }
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int64_t value = 0;
+  for (auto _ : state) {
+    ping.try_push(value);
+    while (!pong.try_pop(value)) {
+      std::this_thread::yield();
+    }
+  }
+  ping.try_push(-1);
+  echo.join();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SpscThroughput, s21::spsc_queue<int64_t>)
+    ->Arg(1)
+    ->Arg(64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpscThroughput, LockedQueue)
+    ->Arg(1)
+    ->Arg(64)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_SpscPingPong, s21::spsc_queue<int64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpscPingPong, LockedQueue)->UseRealTime();
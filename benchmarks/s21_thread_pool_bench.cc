@@ -0,0 +1,94 @@
+#include "s21_thread_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "s21_vector.h"
+
+namespace {
+
+int64_t SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+
+/*
+ *  Fork down to subproblems of kFibCutoff, then recurse serially.
+ */
+constexpr int kFibCutoff = 12;
+
+int64_t ParallelFib(s21::thread_pool &pool, int n) {
+  if (n < kFibCutoff) {
+    return SerialFib(n);
+  }
+  int64_t a = 0;
+  int64_t b = 0;
+  pool.parallel_invoke([&] { a = ParallelFib(pool, n - 1); },
+                       [&] { b = ParallelFib(pool, n - 2); });
+  return a + b;
+}
+
+constexpr int64_t kGrain = 1 << 14;
+
+int64_t ParallelSum(s21::thread_pool &pool, const int64_t *first,
+                    const int64_t *last) {
+  if (last - first <= kGrain) {
+    int64_t sum = 0;
+    for (; first != last; ++first) {
+      sum += *first;
+    }
+    return sum;
+  }
+  const int64_t *middle = first + (last - first) / 2;
+  int64_t left = 0;
+  int64_t right = 0;
+  pool.parallel_invoke([&] { left = ParallelSum(pool, first, middle); },
+                       [&] { right = ParallelSum(pool, middle, last); });
+  return left + right;
+}
+
+/*
+ *  fib(30) on a pool of state.range(0) workers, 0 for the serial
+ *  recursion. The pool is created outside the timed loop.
+ */
+void BM_Fib(benchmark::State &state) {
+  const int threads = state.range(0);
+  s21::thread_pool pool(threads == 0 ? 1 : threads);
+  for (auto _ : state) {
+    int64_t fib = threads == 0 ? SerialFib(30) : ParallelFib(pool, 30);
+    benchmark::DoNotOptimize(fib);
+  }
+}
+
+/*
+ *  Sum of a 64 MiB s21::vector on state.range(0) workers, 0 for a plain
+ *  loop.
+ */
+void BM_ParallelReduce(benchmark::State &state) {
+  const int threads = state.range(0);
+  s21::vector<int64_t> values(1 << 23);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i;
+  }
+  const int64_t *first = values.data();
+  const int64_t *last = first + values.size();
+  s21::thread_pool pool(threads == 0 ? 1 : threads);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    if (threads == 0) {
+      for (const int64_t *it = first; it != last; ++it) {
+        sum += *it;
+      }
+    } else {
+      sum = ParallelSum(pool, first, last);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() *
+                          sizeof(int64_t));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Fib)->DenseRange(0, 2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_ParallelReduce)->DenseRange(0, 2)->Arg(4)->Arg(8)->UseRealTime();
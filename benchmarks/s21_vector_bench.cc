@@ -0,0 +1,393 @@
+#include "s21_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_mmap_allocator.h"
+
+namespace {
+
+/*
+ *  A string payload that counts how many times it was copied or moved.
+ *  The string is long enough to defeat the small string optimization,
+ *  so every copy is a real heap allocation.
+ */
+class CountedString {
+ public:
+  static size_t copies;
+  static size_t moves;
+
+  CountedString(void) : value_(48, 'x') {}
+  CountedString(const CountedString &other) : value_(other.value_) {
+    ++copies;
+  }
+  CountedString(CountedString &&other) noexcept
+      : value_(std::move(other.value_)) {
+    ++moves;
+  }
+  CountedString &operator=(const CountedString &other) {
+    value_ = other.value_;
+    ++copies;
+    return *this;
+  }
+  CountedString &operator=(CountedString &&other) noexcept {
+    value_ = std::move(other.value_);
+    ++moves;
+    return *this;
+  }
+
+ private:
+  std::string value_;
+};
+
+size_t CountedString::copies = 0;
+size_t CountedString::moves = 0;
+
+void ResetCounters(void) {
+  CountedString::copies = 0;
+  CountedString::moves = 0;
+}
+
+/*
+ *  Report copies and moves per iteration. Copies include the ones
+ *  made by push_back itself, so "copies" == elements pushed means that
+ *  no copy was spent on relocation.
+ */
+void ReportCounters(benchmark::State &state) {
+  state.counters["copies"] = benchmark::Counter(
+      static_cast<double>(CountedString::copies),
+      benchmark::Counter::kAvgIterations);
+  state.counters["moves"] = benchmark::Counter(
+      static_cast<double>(CountedString::moves),
+      benchmark::Counter::kAvgIterations);
+}
+
+template <typename Vector>
+void BM_PushBackString(benchmark::State &state) {
+  const CountedString value;
+  ResetCounters();
+  for (auto _ : state) {
+    Vector v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(value);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  ReportCounters(state);
+}
+
+template <typename Outer>
+void BM_PushBackNested(benchmark::State &state) {
+  using Inner = typename Outer::value_type;
+  const Inner row(8);
+  ResetCounters();
+  for (auto _ : state) {
+    Outer v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(row);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  ReportCounters(state);
+}
+
+template <typename Vector>
+void BM_InsertEraseFront(benchmark::State &state) {
+  const CountedString value;
+  Vector v;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    v.push_back(value);
+  }
+  v.reserve(v.size() + 1);
+  ResetCounters();
+  for (auto _ : state) {
+    v.insert(v.begin(), value);
+    v.erase(v.begin());
+  }
+  ReportCounters(state);
+}
+
+enum InsertPosition { kFront, kMiddle, kBack };
+
+s21::vector<int>::iterator PositionOf(s21::vector<int> &v, int64_t where) {
+  if (where == kFront) {
+    return v.begin();
+  } else if (where == kMiddle) {
+    return v.begin() + v.size() / 2;
+  }
+  return v.end();
+}
+
+/*
+ *  Bulk insert of k elements: one capacity check and one tail shift.
+ *  Copying the base vector is part of the measured loop in both cases.
+ */
+void BM_InsertBulk(benchmark::State &state) {
+  const s21::vector<int> base(4096);
+  const s21::vector<int> values(state.range(1));
+  s21::vector<int> v;
+  for (auto _ : state) {
+    v = base;
+    v.insert(PositionOf(v, state.range(0)), values.begin(), values.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+/*
+ *  The former insert_many: k single-element inserts.
+ */
+void BM_InsertOneByOne(benchmark::State &state) {
+  const s21::vector<int> base(4096);
+  const s21::vector<int> values(state.range(1));
+  s21::vector<int> v;
+  for (auto _ : state) {
+    v = base;
+    s21::vector<int>::iterator pos = PositionOf(v, state.range(0));
+    for (int value : values) {
+      pos = v.insert(pos, value) + 1;
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+void InsertArgs(benchmark::internal::Benchmark *b) {
+  for (int64_t where : {kFront, kMiddle, kBack}) {
+    for (int64_t k = 1; k <= 1024; k *= 4) {
+      b->Args({where, k});
+    }
+  }
+}
+
+template <typename Vector>
+void BM_U64SizedCtor(benchmark::State &state) {
+  for (auto _ : state) {
+    Vector v(state.range(0));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(uint64_t));
+}
+
+template <typename Vector>
+void BM_U64CopyCtor(benchmark::State &state) {
+  const Vector source(state.range(0));
+  for (auto _ : state) {
+    Vector v(source);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(uint64_t));
+}
+
+template <typename Vector>
+void BM_U64PushBack(benchmark::State &state) {
+  for (auto _ : state) {
+    Vector v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Vector>
+void BM_U64InsertEraseFront(benchmark::State &state) {
+  Vector v(state.range(0));
+  v.reserve(v.size() + 1);
+  for (auto _ : state) {
+    v.insert(v.begin(), 1);
+    v.erase(v.begin());
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+/*
+ *  Fill a vector one element at a time and report how many times it was
+ *  reallocated and how many bytes stay unused at the end.
+ */
+template <typename Vector>
+void BM_GrowthPolicy(benchmark::State &state) {
+  size_t reallocations = 0;
+  size_t slack = 0;
+  for (auto _ : state) {
+    Vector v;
+    reallocations = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      if (v.size() == v.capacity()) {
+        ++reallocations;
+      }
+      v.push_back(i);
+    }
+    slack = v.slack_bytes();
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["reallocs"] = static_cast<double>(reallocations);
+  state.counters["slack_bytes"] = static_cast<double>(slack);
+}
+
+/*
+ *  An I/O staging buffer: resize, then overwrite the whole buffer
+ *  as read() would. Mode 0 uses resize, mode 1 resize_uninitialized.
+ */
+template <typename Vector>
+void BM_StagingBuffer(benchmark::State &state) {
+  const std::vector<char> source(state.range(0), 'x');
+  Vector v;
+  for (auto _ : state) {
+    v.clear();
+    if constexpr (std::is_same<Vector, s21::vector<char>>::value) {
+      if (state.range(1) == 0) {
+        v.resize(source.size());
+      } else {
+        v.resize_uninitialized(source.size());
+      }
+    } else {
+      v.resize(source.size());
+    }
+    std::memcpy(v.data(), source.data(), source.size());
+    benchmark::DoNotOptimize(v.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ *  Periodic expiry pass: drop every third element of a vector.
+ */
+void BM_ExpireEraseIf(benchmark::State &state) {
+  const s21::vector<uint64_t> base(state.range(0));
+  s21::vector<uint64_t> v;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v = base;
+    for (size_t i = 0; i < v.size(); ++i) {
+      v[i] = i;
+    }
+    state.ResumeTiming();
+    s21::erase_if(v, [](uint64_t x) { return x % 3 == 0; });
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ *  The same pass with one single-element erase per expired element.
+ */
+void BM_ExpireEraseLoop(benchmark::State &state) {
+  const s21::vector<uint64_t> base(state.range(0));
+  s21::vector<uint64_t> v;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v = base;
+    for (size_t i = 0; i < v.size(); ++i) {
+      v[i] = i;
+    }
+    state.ResumeTiming();
+    for (auto it = v.begin(); it != v.end();) {
+      if (*it % 3 == 0) {
+        v.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ *  Grow a large buffer one element at a time. With mmap_allocator
+ *  the storage is extended by mremap instead of being copied.
+ */
+template <typename Vector>
+void BM_LargeGrowth(benchmark::State &state) {
+  for (auto _ : state) {
+    Vector v;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(uint64_t));
+}
+
+using MmapVector = s21::vector<uint64_t, s21::mmap_allocator<uint64_t>>;
+using HugePageVector =
+    s21::vector<uint64_t, s21::mmap_allocator<uint64_t, true>>;
+
+template <typename Policy>
+using GrowthVector = s21::vector<uint64_t, std::allocator<uint64_t>, Policy>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PushBackString, s21::vector<CountedString>)
+    ->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBackString, std::vector<CountedString>)
+    ->Range(1 << 6, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_PushBackNested, s21::vector<s21::vector<CountedString>>)
+    ->Range(1 << 6, 1 << 14);
+BENCHMARK_TEMPLATE(BM_PushBackNested, std::vector<std::vector<CountedString>>)
+    ->Range(1 << 6, 1 << 14);
+
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, s21::vector<CountedString>)
+    ->Range(1 << 6, 1 << 14);
+BENCHMARK_TEMPLATE(BM_InsertEraseFront, std::vector<CountedString>)
+    ->Range(1 << 6, 1 << 14);
+
+BENCHMARK(BM_InsertBulk)->Apply(InsertArgs);
+BENCHMARK(BM_InsertOneByOne)->Apply(InsertArgs);
+
+BENCHMARK_TEMPLATE(BM_U64SizedCtor, s21::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_U64SizedCtor, std::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_U64CopyCtor, s21::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_U64CopyCtor, std::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_U64PushBack, s21::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_U64PushBack, std::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_U64InsertEraseFront, s21::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_U64InsertEraseFront, std::vector<uint64_t>)
+    ->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_GrowthPolicy, GrowthVector<s21::DoublingGrowth>)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_GrowthPolicy, GrowthVector<s21::OneAndHalfGrowth>)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_GrowthPolicy, GrowthVector<s21::JemallocGrowth>)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000000);
+
+BENCHMARK_TEMPLATE(BM_StagingBuffer, s21::vector<char>)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_StagingBuffer, std::vector<char>)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {0}});
+
+BENCHMARK(BM_ExpireEraseIf)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_ExpireEraseLoop)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_LargeGrowth, s21::vector<uint64_t>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 18, 1 << 27);
+BENCHMARK_TEMPLATE(BM_LargeGrowth, MmapVector)
+    ->RangeMultiplier(8)
+    ->Range(1 << 18, 1 << 27);
+BENCHMARK_TEMPLATE(BM_LargeGrowth, HugePageVector)
+    ->RangeMultiplier(8)
+    ->Range(1 << 18, 1 << 27);
@@ -6,8 +6,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_utils.h"
+
 namespace s21 {
 
 template <typename T, size_t N>
@@ -79,7 +82,11 @@ array<T, N>::array(std::initializer_list<T> const &items) : elements_() {
 
 template <typename T, size_t N>
 array<T, N>::array(const array<T, N> &other) {
-  std::copy_n(other.elements_, N, elements_);
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    TrivialCopy(other.elements_, N, elements_);
+  } else {
+    std::copy_n(other.elements_, N, elements_);
+  }
 }
 
 template <typename T, size_t N>
@@ -89,7 +96,13 @@ array<T, N>::array(array<T, N> &&other) : elements_() {
 
 template <typename T, size_t N>
 array<T, N> &array<T, N>::operator=(const array<T, N> &other) {
-  std::copy_n(other.elements_, N, elements_);
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (this != &other) {
+      TrivialCopy(other.elements_, N, elements_);
+    }
+  } else {
+    std::copy_n(other.elements_, N, elements_);
+  }
   return *this;
 }
 
@@ -220,7 +233,11 @@ void array<T, N>::swap(array<T, N> &other) noexcept {
 
 template <typename T, size_t N>
 void array<T, N>::fill(array<T, N>::const_reference value) {
-  std::fill_n(elements_, N, value);
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    TrivialFill(elements_, N, value);
+  } else {
+    std::fill_n(elements_, N, value);
+  }
 }
 
 }  // namespace s21
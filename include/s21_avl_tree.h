@@ -1317,6 +1317,31 @@ int AvlTree<K, V, KoV, C, A>::verify(void) const {
   return 0;
 }
 
+// Erasure by predicate for the tree based containers.
+
+/*
+ *  Erase the elements that satisfy the predicate in one in-order sweep.
+ *  Erasing a node leaves the other nodes in place, so the iterator
+ *  to the next element stays valid. Returns the number of erased elements.
+ */
+template <typename Container, typename Predicate>
+typename Container::size_type TreeEraseIf(Container& container,
+                                          Predicate pred) {
+  typename Container::size_type old_size = container.size();
+  typename Container::iterator it = container.begin();
+  typename Container::iterator last = container.end();
+  while (it != last) {
+    if (pred(*it)) {
+      typename Container::iterator victim = it;
+      ++it;
+      container.erase(victim);
+    } else {
+      ++it;
+    }
+  }
+  return old_size - container.size();
+}
+
 }  // namespace s21
 
 #endif  // INCLUDE_S21_AVL_TREE_H_
@@ -0,0 +1,338 @@
+#ifndef INCLUDE_S21_BLOCKING_QUEUE_H_
+#define INCLUDE_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "s21_deque.h"
+
+namespace s21 {
+
+/*
+ *  FIFO queue shared by producer and consumer threads under one mutex.
+ *  pop waits for a value, pop_batch takes up to n values per lock
+ *  acquisition, and try_pop_for waits with a timeout. With a capacity
+ *  the queue is bounded and push waits for room, which gives producers
+ *  backpressure. A capacity of 0 means unbounded.
+ *
+ *  close() ends the queue: push fails from then on, and pop fails once
+ *  the remaining values are drained. Waiting threads are woken.
+ *
+ *  Threads sleep on one condition variable per side and are notified
+ *  only when the waiter count of that side, read under the lock, is not
+ *  zero, so an uncontended push or pop makes no notify call.
+ *
+ *  The container must provide front, pop_front, push_back, emplace_back,
+ *  empty and size, as s21::deque and s21::ring_buffer do.
+ */
+template <typename T, typename Container = deque<T>>
+class blocking_queue final {
+ public:
+  using container_type = Container;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
+
+  explicit blocking_queue(size_type capacity = 0);
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  bool empty(void) const;
+  size_type size(void) const;
+  size_type capacity(void) const noexcept;
+  bool closed(void) const;
+
+  bool push(const_reference value);
+  bool push(value_type &&value);
+  template <typename... Args>
+  bool emplace(Args &&...args);
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+
+  bool pop(reference out);
+  bool try_pop(reference out);
+  template <typename Rep, typename Period>
+  bool try_pop_for(reference out,
+                   const std::chrono::duration<Rep, Period> &timeout);
+  template <typename OutputIt>
+  size_type pop_batch(OutputIt out, size_type max_n);
+
+  void close(void);
+
+ private:
+  bool full(void) const noexcept;
+  size_type take(reference out);
+
+ private:
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  Container container_;
+  size_type capacity_;
+  size_type waiting_pushers_;
+  size_type waiting_poppers_;
+  bool closed_;
+};
+
+// Ctors
+
+template <typename T, typename C>
+blocking_queue<T, C>::blocking_queue(size_type capacity)
+    : container_(),
+      capacity_(capacity),
+      waiting_pushers_(0),
+      waiting_poppers_(0),
+      closed_(false) {}
+
+// CAPACITY
+
+template <typename T, typename C>
+bool blocking_queue<T, C>::empty(void) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return container_.empty();
+}
+
+template <typename T, typename C>
+typename blocking_queue<T, C>::size_type blocking_queue<T, C>::size(
+    void) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return container_.size();
+}
+
+template <typename T, typename C>
+inline typename blocking_queue<T, C>::size_type
+blocking_queue<T, C>::capacity(void) const noexcept {
+  return capacity_;
+}
+
+template <typename T, typename C>
+bool blocking_queue<T, C>::closed(void) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+// PRODUCERS
+
+template <typename T, typename C>
+inline bool blocking_queue<T, C>::push(const_reference value) {
+  return emplace(value);
+}
+
+template <typename T, typename C>
+inline bool blocking_queue<T, C>::push(value_type &&value) {
+  return emplace(std::move(value));
+}
+
+/*
+ *  Construct a value at the end, waiting while the queue is full.
+ *  Returns false without using args if the queue is closed.
+ */
+template <typename T, typename C>
+template <typename... Args>
+bool blocking_queue<T, C>::emplace(Args &&...args) {
+  bool wake;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (full() && !closed_) {
+      ++waiting_pushers_;
+      not_full_.wait(lock, [this] { return !full() || closed_; });
+      --waiting_pushers_;
+    }
+    if (closed_) {
+      return false;
+    }
+    container_.emplace_back(std::forward<Args>(args)...);
+    wake = waiting_poppers_ != 0;
+  }
+  if (wake) {
+    not_empty_.notify_one();
+  }
+  return true;
+}
+
+/*
+ *  Push a value unless the queue is full or closed.
+ */
+template <typename T, typename C>
+bool blocking_queue<T, C>::try_push(const_reference value) {
+  bool wake;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (full() || closed_) {
+      return false;
+    }
+    container_.push_back(value);
+    wake = waiting_poppers_ != 0;
+  }
+  if (wake) {
+    not_empty_.notify_one();
+  }
+  return true;
+}
+
+template <typename T, typename C>
+bool blocking_queue<T, C>::try_push(value_type &&value) {
+  bool wake;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (full() || closed_) {
+      return false;
+    }
+    container_.push_back(std::move(value));
+    wake = waiting_poppers_ != 0;
+  }
+  if (wake) {
+    not_empty_.notify_one();
+  }
+  return true;
+}
+
+// CONSUMERS
+
+/*
+ *  Move the front value to out, waiting while the queue is empty.
+ *  Returns false if the queue is closed and drained.
+ */
+template <typename T, typename C>
+bool blocking_queue<T, C>::pop(reference out) {
+  size_type popped;
+  bool wake;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (container_.empty() && !closed_) {
+      ++waiting_poppers_;
+      not_empty_.wait(lock, [this] { return !container_.empty() || closed_; });
+      --waiting_poppers_;
+    }
+    popped = take(out);
+    wake = popped != 0 && waiting_pushers_ != 0;
+  }
+  if (wake) {
+    not_full_.notify_one();
+  }
+  return popped != 0;
+}
+
+/*
+ *  Move the front value to out if there is one.
+ */
+template <typename T, typename C>
+bool blocking_queue<T, C>::try_pop(reference out) {
+  size_type popped;
+  bool wake;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    popped = take(out);
+    wake = popped != 0 && waiting_pushers_ != 0;
+  }
+  if (wake) {
+    not_full_.notify_one();
+  }
+  return popped != 0;
+}
+
+/*
+ *  Like pop, but gives up and returns false after timeout.
+ */
+template <typename T, typename C>
+template <typename Rep, typename Period>
+bool blocking_queue<T, C>::try_pop_for(
+    reference out, const std::chrono::duration<Rep, Period> &timeout) {
+  size_type popped;
+  bool wake;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (container_.empty() && !closed_) {
+      ++waiting_poppers_;
+      not_empty_.wait_for(lock, timeout, [this] {
+        return !container_.empty() || closed_;
+      });
+      --waiting_poppers_;
+    }
+    popped = take(out);
+    wake = popped != 0 && waiting_pushers_ != 0;
+  }
+  if (wake) {
+    not_full_.notify_one();
+  }
+  return popped != 0;
+}
+
+/*
+ *  Wait for a value, then move up to max_n front values to out under
+ *  the same lock. Returns the number of values written, which is 0 only
+ *  if the queue is closed and drained or max_n is 0.
+ */
+template <typename T, typename C>
+template <typename OutputIt>
+typename blocking_queue<T, C>::size_type blocking_queue<T, C>::pop_batch(
+    OutputIt out, size_type max_n) {
+  size_type popped = 0;
+  bool wake;
+  if (max_n == 0) {
+    return 0;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (container_.empty() && !closed_) {
+      ++waiting_poppers_;
+      not_empty_.wait(lock, [this] { return !container_.empty() || closed_; });
+      --waiting_poppers_;
+    }
+    for (; popped < max_n && !container_.empty(); ++popped) {
+      *out = std::move(container_.front());
+      ++out;
+      container_.pop_front();
+    }
+    wake = popped != 0 && waiting_pushers_ != 0;
+  }
+  if (wake && popped == 1) {
+    not_full_.notify_one();
+  } else if (wake) {
+    not_full_.notify_all();
+  }
+  return popped;
+}
+
+/*
+ *  Refuse new values and wake every waiting thread.
+ */
+template <typename T, typename C>
+void blocking_queue<T, C>::close(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  not_empty_.notify_all();
+  not_full_.notify_all();
+}
+
+// Support functions
+
+template <typename T, typename C>
+inline bool blocking_queue<T, C>::full(void) const noexcept {
+  return capacity_ != 0 && container_.size() >= capacity_;
+}
+
+/*
+ *  Move the front value to out and remove it. Returns the number of
+ *  values removed. The lock must be held.
+ */
+template <typename T, typename C>
+typename blocking_queue<T, C>::size_type blocking_queue<T, C>::take(
+    reference out) {
+  if (container_.empty()) {
+    return 0;
+  }
+  out = std::move(container_.front());
+  container_.pop_front();
+  return 1;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_BLOCKING_QUEUE_H_
@@ -0,0 +1,234 @@
+#ifndef INCLUDE_S21_CONCURRENT_STACK_H_
+#define INCLUDE_S21_CONCURRENT_STACK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_epoch.h"
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Lock-free LIFO stack for any number of threads, after Treiber: a
+ *  singly linked list whose top is swapped with compare-and-swap.
+ *
+ *  A popped node can't be freed at once, because another pop may have
+ *  read the same top and be about to read its next link. Pops run in an
+ *  epoch_domain guard and retire the nodes they unlink, so a node is
+ *  freed only when no pop can see it any more.
+ *
+ *  The same rule prevents ABA: a node stays allocated while any pop
+ *  may still compare against it, so the top can't come back to an equal
+ *  pointer under a pending compare-and-swap. push never dereferences
+ *  shared nodes and needs no guard. For the same reason a popped node
+ *  can't be put back, so T must be nothrow move assignable.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_stack final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "concurrent_stack: allocator value_type must be T");
+  static_assert(std::is_nothrow_move_assignable<T>::value,
+                "concurrent_stack: T must be nothrow move assignable");
+
+  concurrent_stack(void);
+  explicit concurrent_stack(const allocator_type &alloc);
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack(void);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  bool empty(void) const noexcept;
+
+  void push(const_reference value);
+  void push(value_type &&value);
+  template <typename... Args>
+  void emplace(Args &&...args);
+  template <typename InputIt>
+  void push_chain(InputIt first, InputIt last);
+  bool try_pop(reference out) noexcept;
+
+ private:
+  struct Node : epoch_hook {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    T value;
+    Node *next = nullptr;
+  };
+
+  using NodeAllocator = typename AllocTraits::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  using Domain = epoch_domain<Node, NodeAllocator>;
+
+  template <typename... Args>
+  Node *create_node(Args &&...args);
+  void destroy_node(Node *node) noexcept;
+  void link(Node *first, Node *last) noexcept;
+
+ private:
+  NodeAllocator allocator_;
+  alignas(kCacheLineSize) std::atomic<Node *> top_;
+  Domain domain_;
+};
+
+// Ctors, Dtor
+
+template <typename T, typename A>
+concurrent_stack<T, A>::concurrent_stack(void)
+    : concurrent_stack(allocator_type()) {}
+
+template <typename T, typename A>
+concurrent_stack<T, A>::concurrent_stack(const allocator_type &alloc)
+    : allocator_(alloc), top_(nullptr), domain_(allocator_) {}
+
+/*
+ *  No other thread may use the stack any more.
+ */
+template <typename T, typename A>
+concurrent_stack<T, A>::~concurrent_stack(void) {
+  Node *node = top_.load(std::memory_order_relaxed);
+  while (node != nullptr) {
+    Node *next = node->next;
+    destroy_node(node);
+    node = next;
+  }
+}
+
+template <typename T, typename A>
+inline typename concurrent_stack<T, A>::allocator_type
+concurrent_stack<T, A>::get_allocator(void) const noexcept {
+  return allocator_type(allocator_);
+}
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline bool concurrent_stack<T, A>::empty(void) const noexcept {
+  return top_.load(std::memory_order_acquire) == nullptr;
+}
+
+// MODIFIERS
+
+template <typename T, typename A>
+inline void concurrent_stack<T, A>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T, typename A>
+inline void concurrent_stack<T, A>::push(value_type &&value) {
+  emplace(std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void concurrent_stack<T, A>::emplace(Args &&...args) {
+  Node *node = create_node(std::forward<Args>(args)...);
+  link(node, node);
+}
+
+/*
+ *  Push the values of [first, last) with one compare-and-swap, so other
+ *  threads see all of them or none. The last value ends up on top.
+ *  Nothing is pushed if an exception is thrown.
+ */
+template <typename T, typename A>
+template <typename InputIt>
+void concurrent_stack<T, A>::push_chain(InputIt first, InputIt last) {
+  if (first == last) {
+    return;
+  }
+  Node *bottom = create_node(*first);
+  Node *top = bottom;
+  try {
+    for (++first; first != last; ++first) {
+      Node *node = create_node(*first);
+      node->next = top;
+      top = node;
+    }
+  } catch (...) {
+    while (top != bottom) {
+      Node *next = top->next;
+      destroy_node(top);
+      top = next;
+    }
+    destroy_node(bottom);
+    throw;
+  }
+  link(top, bottom);
+}
+
+/*
+ *  Move the top value to out and remove it.
+ *  Returns false if the stack is empty.
+ */
+template <typename T, typename A>
+bool concurrent_stack<T, A>::try_pop(reference out) noexcept {
+  typename Domain::guard guard(domain_);
+  Node *node = top_.load(std::memory_order_acquire);
+  while (node != nullptr &&
+         !top_.compare_exchange_weak(node, node->next,
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+  }
+  if (node == nullptr) {
+    return false;
+  }
+  // The node is ours now, other threads may only read its next link.
+  out = std::move(node->value);
+  guard.retire(node);
+  return true;
+}
+
+// Support functions
+
+template <typename T, typename A>
+template <typename... Args>
+typename concurrent_stack<T, A>::Node *concurrent_stack<T, A>::create_node(
+    Args &&...args) {
+  Node *node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename A>
+void concurrent_stack<T, A>::destroy_node(Node *node) noexcept {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
+/*
+ *  Put the chain from first down to last on top of the stack.
+ */
+template <typename T, typename A>
+void concurrent_stack<T, A>::link(Node *first, Node *last) noexcept {
+  Node *top = top_.load(std::memory_order_relaxed);
+  do {
+    last->next = top;
+  } while (!top_.compare_exchange_weak(top, first, std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_CONCURRENT_STACK_H_
@@ -3,6 +3,7 @@
 #ifndef INCLUDE_S21_CONTAINERS_H_
 #define INCLUDE_S21_CONTAINERS_H_
 
+#include "s21_deque.h"
 #include "s21_list.h"
 #include "s21_map.h"
 #include "s21_queue.h"
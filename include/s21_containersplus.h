@@ -4,6 +4,19 @@
 #define INCLUDE_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_blocking_queue.h"
+#include "s21_concurrent_stack.h"
+#include "s21_epoch.h"
+#include "s21_indexed_heap.h"
+#include "s21_intrusive_list.h"
+#include "s21_mmap_allocator.h"
+#include "s21_mpmc_queue.h"
 #include "s21_multiset.h"
+#include "s21_priority_queue.h"
+#include "s21_ring_buffer.h"
+#include "s21_small_vector.h"
+#include "s21_spsc_queue.h"
+#include "s21_thread_pool.h"
+#include "s21_ws_deque.h"
 
 #endif  // INCLUDE_S21_CONTAINERSPLUS_H_
@@ -0,0 +1,761 @@
+#ifndef INCLUDE_S21_DEQUE_H_
+#define INCLUDE_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/*
+ *  Number of elements in a deque block: 4 KiB worth of small values,
+ *  16 values of a large type.
+ */
+template <typename T>
+constexpr size_t DequeBlockSize(void) {
+  return sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+}
+
+// DEQUE_ITERATOR
+
+/*
+ *  Random access iterator over the blocks of a deque. It keeps the block
+ *  map and the index of the element from the start of the map, so it is
+ *  invalidated when the deque reallocates its map.
+ */
+template <typename T, typename Pointer, typename Reference>
+class DequeIterator final {
+ public:
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using pointer = Pointer;
+  using reference = Reference;
+
+  DequeIterator(void) : map_(nullptr), index_(0) {}
+
+  DequeIterator(T *const *map, size_t index) : map_(map), index_(index) {}
+
+  template <typename P, typename R,
+            typename = typename std::enable_if<
+                std::is_convertible<P, Pointer>::value>::type>
+  DequeIterator(const DequeIterator<T, P, R> &other)
+      : map_(other.map_), index_(other.index_) {}
+
+  reference operator*(void) const {
+    return map_[index_ / kBlockSize][index_ % kBlockSize];
+  }
+
+  pointer operator->(void) const { return &**this; }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  DequeIterator &operator++(void) {
+    ++index_;
+    return *this;
+  }
+
+  DequeIterator operator++(int) {
+    DequeIterator tmp{*this};
+    ++index_;
+    return tmp;
+  }
+
+  DequeIterator &operator--(void) {
+    --index_;
+    return *this;
+  }
+
+  DequeIterator operator--(int) {
+    DequeIterator tmp{*this};
+    --index_;
+    return tmp;
+  }
+
+  DequeIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  DequeIterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  DequeIterator operator+(difference_type n) const {
+    return DequeIterator(map_, index_ + n);
+  }
+
+  DequeIterator operator-(difference_type n) const {
+    return DequeIterator(map_, index_ - n);
+  }
+
+  friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+    return it + n;
+  }
+
+  friend difference_type operator-(const DequeIterator &lhs,
+                                   const DequeIterator &rhs) {
+    return static_cast<difference_type>(lhs.index_ - rhs.index_);
+  }
+
+  friend bool operator==(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return rhs < lhs;
+  }
+
+  friend bool operator<=(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return !(rhs < lhs);
+  }
+
+  friend bool operator>=(const DequeIterator &lhs, const DequeIterator &rhs) {
+    return !(lhs < rhs);
+  }
+
+ private:
+  template <typename, typename, typename>
+  friend class DequeIterator;
+
+  static constexpr size_t kBlockSize = DequeBlockSize<T>();
+
+  T *const *map_;
+  size_t index_;
+};
+
+// DEQUE
+
+/*
+ *  Double-ended queue stored in fixed-size blocks. A map of block
+ *  pointers keeps the blocks in order, so both ends grow in O(1)
+ *  and elements never move while the deque grows.
+ *
+ *  Emptied blocks are kept for reuse: pop_back leaves them in place for
+ *  the next push_back, pop_front moves them behind the last block. So a
+ *  deque used as a stack or a queue stops allocating once it reaches its
+ *  working size. shrink_to_fit releases the spare blocks.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class deque final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using MapAllocator = typename AllocTraits::template rebind_alloc<T *>;
+  using MapAllocTraits = std::allocator_traits<MapAllocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = DequeIterator<T, T *, T &>;
+  using const_iterator = DequeIterator<T, const T *, const T &>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "deque: allocator value_type must be T");
+  static_assert(std::is_same<typename AllocTraits::pointer, T *>::value,
+                "deque: allocator must use raw pointers");
+
+  deque(void);
+  explicit deque(const allocator_type &alloc);
+  explicit deque(size_type n, const allocator_type &alloc = allocator_type());
+  deque(std::initializer_list<value_type> const &items,
+        const allocator_type &alloc = allocator_type());
+  deque(const deque &other);
+  deque(const deque &other, const allocator_type &alloc);
+  deque(deque &&other) noexcept;
+  ~deque(void);
+  deque &operator=(const deque &other);
+  deque &operator=(deque &&other) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front(void);
+  const_reference front(void) const;
+  reference back(void);
+  const_reference back(void) const;
+
+  iterator begin(void) noexcept;
+  const_iterator begin(void) const noexcept;
+  iterator end(void) noexcept;
+  const_iterator end(void) const noexcept;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type max_size(void) const noexcept;
+  void shrink_to_fit(void);
+
+  void clear(void) noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back(void);
+  void pop_front(void);
+  void swap(deque &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  static constexpr size_type kBlockSize = DequeBlockSize<T>();
+  static constexpr size_type kMinMapSize = 8;
+
+  pointer cell(size_type index) const noexcept;
+  void reserve_back(size_type n);
+  void reserve_front(size_type n);
+  void reallocate_map(size_type front_room, size_type back_room);
+  void allocate_blocks(size_type first, size_type last);
+  void recycle_block(size_type block, size_type target) noexcept;
+  void release(void) noexcept;
+  void swap_data(deque &other) noexcept;
+
+ private:
+  allocator_type allocator_;
+  pointer *map_;
+  size_type map_size_;
+  size_type start_;
+  size_type finish_;
+};
+
+// Ctors, Dtor, overloaded operator=
+
+template <typename T, typename A>
+deque<T, A>::deque(void)
+    : allocator_(), map_(nullptr), map_size_(0), start_(0), finish_(0) {}
+
+template <typename T, typename A>
+deque<T, A>::deque(const allocator_type &alloc)
+    : allocator_(alloc), map_(nullptr), map_size_(0), start_(0), finish_(0) {}
+
+template <typename T, typename A>
+deque<T, A>::deque(size_type n, const allocator_type &alloc) : deque(alloc) {
+  reserve_back(n);
+  while (size() < n) {
+    emplace_back();
+  }
+}
+
+template <typename T, typename A>
+deque<T, A>::deque(std::initializer_list<value_type> const &items,
+                   const allocator_type &alloc)
+    : deque(alloc) {
+  reserve_back(items.size());
+  for (const_reference item : items) {
+    push_back(item);
+  }
+}
+
+template <typename T, typename A>
+deque<T, A>::deque(const deque &other)
+    : deque(other, AllocTraits::select_on_container_copy_construction(
+                       other.allocator_)) {}
+
+template <typename T, typename A>
+deque<T, A>::deque(const deque &other, const allocator_type &alloc)
+    : deque(alloc) {
+  reserve_back(other.size());
+  for (const_reference item : other) {
+    push_back(item);
+  }
+}
+
+template <typename T, typename A>
+deque<T, A>::deque(deque &&other) noexcept
+    : allocator_(std::move(other.allocator_)),
+      map_(nullptr),
+      map_size_(0),
+      start_(0),
+      finish_(0) {
+  swap_data(other);
+}
+
+template <typename T, typename A>
+deque<T, A>::~deque(void) {
+  release();
+}
+
+template <typename T, typename A>
+deque<T, A> &deque<T, A>::operator=(const deque &other) {
+  if (this != &other) {
+    constexpr bool propagate =
+        AllocTraits::propagate_on_container_copy_assignment::value;
+    deque tmp(other, propagate ? other.allocator_ : allocator_);
+    release();
+    if constexpr (propagate) {
+      allocator_ = other.allocator_;
+    }
+    swap_data(tmp);
+  }
+  return *this;
+}
+
+template <typename T, typename A>
+deque<T, A> &deque<T, A>::operator=(deque &&other) noexcept(
+    AllocTraits::propagate_on_container_move_assignment::value ||
+    AllocTraits::is_always_equal::value) {
+  if (this != &other) {
+    release();
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(other.allocator_);
+      swap_data(other);
+    } else {
+      if (allocator_ == other.allocator_) {
+        swap_data(other);
+      } else {
+        for (reference item : other) {
+          push_back(std::move(item));
+        }
+        other.clear();
+      }
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::allocator_type deque<T, A>::get_allocator(
+    void) const noexcept {
+  return allocator_;
+}
+
+// ELEMENT ACCESS
+
+template <typename T, typename A>
+inline typename deque<T, A>::reference deque<T, A>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("deque: index out of range");
+  }
+  return *cell(start_ + pos);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_reference deque<T, A>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("deque: index out of range");
+  }
+  return *cell(start_ + pos);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::reference deque<T, A>::operator[](
+    size_type pos) {
+  return *cell(start_ + pos);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_reference deque<T, A>::operator[](
+    size_type pos) const {
+  return *cell(start_ + pos);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::reference deque<T, A>::front(void) {
+  return *cell(start_);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_reference deque<T, A>::front(void) const {
+  return *cell(start_);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::reference deque<T, A>::back(void) {
+  return *cell(finish_ - 1);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_reference deque<T, A>::back(void) const {
+  return *cell(finish_ - 1);
+}
+
+// ITERATORS
+
+template <typename T, typename A>
+inline typename deque<T, A>::iterator deque<T, A>::begin(void) noexcept {
+  return iterator(map_, start_);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_iterator deque<T, A>::begin(
+    void) const noexcept {
+  return const_iterator(map_, start_);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::iterator deque<T, A>::end(void) noexcept {
+  return iterator(map_, finish_);
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::const_iterator deque<T, A>::end(
+    void) const noexcept {
+  return const_iterator(map_, finish_);
+}
+
+// CAPACITY
+
+template <typename T, typename A>
+inline bool deque<T, A>::empty(void) const noexcept {
+  return start_ == finish_;
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::size_type deque<T, A>::size(
+    void) const noexcept {
+  return finish_ - start_;
+}
+
+template <typename T, typename A>
+inline typename deque<T, A>::size_type deque<T, A>::max_size(
+    void) const noexcept {
+  return AllocTraits::max_size(allocator_);
+}
+
+/*
+ *  Release the blocks that hold no element.
+ */
+template <typename T, typename A>
+void deque<T, A>::shrink_to_fit(void) {
+  if (start_ == finish_) {
+    start_ -= start_ % kBlockSize;
+    finish_ = start_;
+  }
+  size_type first = start_ / kBlockSize;
+  size_type last = start_ == finish_ ? first : (finish_ - 1) / kBlockSize + 1;
+  for (size_type i = 0; i < map_size_; ++i) {
+    if ((i < first || i >= last) && map_[i] != nullptr) {
+      AllocTraits::deallocate(allocator_, map_[i], kBlockSize);
+      map_[i] = nullptr;
+    }
+  }
+}
+
+// MODIFIERS
+
+template <typename T, typename A>
+void deque<T, A>::clear(void) noexcept {
+  while (start_ != finish_) {
+    pop_back();
+  }
+}
+
+template <typename T, typename A>
+inline void deque<T, A>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename A>
+inline void deque<T, A>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename A>
+inline void deque<T, A>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename A>
+inline void deque<T, A>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+/*
+ *  Construct an element in place at the end.
+ *  The deque is left unchanged if an exception is thrown.
+ */
+template <typename T, typename A>
+template <typename... Args>
+typename deque<T, A>::reference deque<T, A>::emplace_back(Args &&...args) {
+  if (finish_ % kBlockSize == 0 && (finish_ == map_size_ * kBlockSize ||
+                                    map_[finish_ / kBlockSize] == nullptr)) {
+    reserve_back(1);
+  }
+  size_type index = finish_;
+  pointer ptr = cell(index);
+  AllocTraits::construct(allocator_, ptr, std::forward<Args>(args)...);
+  finish_ = index + 1;
+  return *ptr;
+}
+
+/*
+ *  Construct an element in place at the beginning.
+ *  The deque is left unchanged if an exception is thrown.
+ */
+template <typename T, typename A>
+template <typename... Args>
+typename deque<T, A>::reference deque<T, A>::emplace_front(Args &&...args) {
+  if (start_ % kBlockSize == 0 &&
+      (start_ == 0 || map_[start_ / kBlockSize - 1] == nullptr)) {
+    reserve_front(1);
+  }
+  size_type index = start_ - 1;
+  pointer ptr = cell(index);
+  AllocTraits::construct(allocator_, ptr, std::forward<Args>(args)...);
+  start_ = index;
+  return *ptr;
+}
+
+/*
+ *  Destroy the last element. A block left empty stays in its slot.
+ */
+template <typename T, typename A>
+void deque<T, A>::pop_back(void) {
+  --finish_;
+  AllocTraits::destroy(allocator_, cell(finish_));
+}
+
+/*
+ *  Destroy the first element. A block left empty is moved behind
+ *  the last block, where push_back will reuse it.
+ */
+template <typename T, typename A>
+void deque<T, A>::pop_front(void) {
+  AllocTraits::destroy(allocator_, cell(start_));
+  ++start_;
+  if (start_ % kBlockSize == 0 && start_ != finish_) {
+    size_type last = (finish_ - 1) / kBlockSize;
+    if (last + 1 < map_size_) {
+      recycle_block(start_ / kBlockSize - 1, last + 1);
+    }
+  }
+}
+
+template <typename T, typename A>
+void deque<T, A>::swap(deque &other) noexcept {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
+  swap_data(other);
+}
+
+template <typename T, typename A>
+template <typename... Args>
+void deque<T, A>::insert_many_back(Args &&...args) {
+  reserve_back(sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+/*
+ *  Insert the arguments at the beginning in their order, so the first
+ *  argument becomes the first element. Nothing is inserted if an
+ *  exception is thrown.
+ */
+template <typename T, typename A>
+template <typename... Args>
+void deque<T, A>::insert_many_front(Args &&...args) {
+  if constexpr (sizeof...(Args) != 0) {
+    reserve_front(sizeof...(args));
+    size_type first = start_ - sizeof...(args);
+    size_type index = first;
+    auto construct = [this, &index](auto &&arg) {
+      AllocTraits::construct(allocator_, cell(index),
+                             std::forward<decltype(arg)>(arg));
+      ++index;
+    };
+    try {
+      (construct(std::forward<Args>(args)), ...);
+    } catch (...) {
+      while (index != first) {
+        AllocTraits::destroy(allocator_, cell(--index));
+      }
+      throw;
+    }
+    start_ = first;
+  }
+}
+
+// Support functions
+
+/*
+ *  Address of the element with the index counted from the start of the map.
+ */
+template <typename T, typename A>
+inline typename deque<T, A>::pointer deque<T, A>::cell(
+    size_type index) const noexcept {
+  return map_[index / kBlockSize] + index % kBlockSize;
+}
+
+/*
+ *  Make room for n elements behind the last one.
+ */
+template <typename T, typename A>
+void deque<T, A>::reserve_back(size_type n) {
+  if (n == 0) {
+    return;
+  }
+  if (max_size() - size() < n) {
+    throw std::length_error("deque: insert exceeds max_size()");
+  }
+  if (map_ == nullptr || map_size_ * kBlockSize - finish_ < n) {
+    reallocate_map(0, n);
+  }
+  allocate_blocks(finish_ / kBlockSize, (finish_ + n - 1) / kBlockSize);
+}
+
+/*
+ *  Make room for n elements before the first one.
+ */
+template <typename T, typename A>
+void deque<T, A>::reserve_front(size_type n) {
+  if (n == 0) {
+    return;
+  }
+  if (max_size() - size() < n) {
+    throw std::length_error("deque: insert exceeds max_size()");
+  }
+  if (map_ == nullptr || start_ < n) {
+    reallocate_map(n, 0);
+  }
+  allocate_blocks((start_ - n) / kBlockSize, (start_ - 1) / kBlockSize);
+}
+
+/*
+ *  Place the used blocks in the middle of a map that has room for
+ *  front_room elements before them and back_room elements after them.
+ *  The map is recentered in place while it is at most half full,
+ *  otherwise a larger map is allocated. Spare blocks are kept.
+ */
+template <typename T, typename A>
+void deque<T, A>::reallocate_map(size_type front_room, size_type back_room) {
+  size_type size = finish_ - start_;
+  size_type offset = size == 0 ? 0 : start_ % kBlockSize;
+  size_type first = start_ / kBlockSize;
+  size_type used = (offset + size + kBlockSize - 1) / kBlockSize;
+  size_type front_blocks =
+      front_room > offset
+          ? (front_room - offset + kBlockSize - 1) / kBlockSize
+          : 0;
+  size_type back_free = used * kBlockSize - offset - size;
+  size_type back_blocks =
+      back_room > back_free
+          ? (back_room - back_free + kBlockSize - 1) / kBlockSize
+          : 0;
+  size_type needed = used + front_blocks + back_blocks;
+
+  if (map_ != nullptr && needed * 2 <= map_size_) {
+    size_type new_first = (map_size_ - needed) / 2 + front_blocks;
+    if (new_first < first) {
+      std::rotate(map_, map_ + (first - new_first), map_ + map_size_);
+    } else if (new_first > first) {
+      std::rotate(map_, map_ + map_size_ - (new_first - first),
+                  map_ + map_size_);
+    }
+    start_ = new_first * kBlockSize + offset;
+    finish_ = start_ + size;
+    return;
+  }
+
+  MapAllocator map_allocator(allocator_);
+  size_type new_size = std::max(std::max(map_size_, needed) * 2, kMinMapSize);
+  pointer *new_map = MapAllocTraits::allocate(map_allocator, new_size);
+  size_type new_first = (new_size - needed) / 2 + front_blocks;
+  std::fill(new_map, new_map + new_size, nullptr);
+  std::copy(map_ + first, map_ + first + used, new_map + new_first);
+  size_type spare = 0;
+  for (size_type i = 0; i < map_size_; ++i) {
+    if ((i < first || i >= first + used) && map_[i] != nullptr) {
+      while (spare >= new_first && spare < new_first + used) {
+        ++spare;
+      }
+      new_map[spare++] = map_[i];
+    }
+  }
+  if (map_ != nullptr) {
+    MapAllocTraits::deallocate(map_allocator, map_, map_size_);
+  }
+  map_ = new_map;
+  map_size_ = new_size;
+  start_ = new_first * kBlockSize + offset;
+  finish_ = start_ + size;
+}
+
+/*
+ *  Allocate the missing blocks of the map in [first, last].
+ */
+template <typename T, typename A>
+void deque<T, A>::allocate_blocks(size_type first, size_type last) {
+  for (size_type i = first; i <= last; ++i) {
+    if (map_[i] == nullptr) {
+      map_[i] = AllocTraits::allocate(allocator_, kBlockSize);
+    }
+  }
+}
+
+/*
+ *  Move the empty block to the target slot if that slot has no block.
+ */
+template <typename T, typename A>
+inline void deque<T, A>::recycle_block(size_type block,
+                                       size_type target) noexcept {
+  if (map_[target] == nullptr) {
+    std::swap(map_[block], map_[target]);
+  }
+}
+
+/*
+ *  Destroy the elements and deallocate the blocks and the map.
+ */
+template <typename T, typename A>
+void deque<T, A>::release(void) noexcept {
+  clear();
+  for (size_type i = 0; i < map_size_; ++i) {
+    if (map_[i] != nullptr) {
+      AllocTraits::deallocate(allocator_, map_[i], kBlockSize);
+    }
+  }
+  if (map_ != nullptr) {
+    MapAllocator map_allocator(allocator_);
+    MapAllocTraits::deallocate(map_allocator, map_, map_size_);
+  }
+  map_ = nullptr;
+  map_size_ = 0;
+  start_ = 0;
+  finish_ = 0;
+}
+
+/*
+ *  Exchange the storage, but not the allocators.
+ */
+template <typename T, typename A>
+inline void deque<T, A>::swap_data(deque &other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(finish_, other.finish_);
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_DEQUE_H_
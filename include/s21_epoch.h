@@ -0,0 +1,226 @@
+#ifndef INCLUDE_S21_EPOCH_H_
+#define INCLUDE_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Base of the nodes an epoch_domain reclaims. The link is used only
+ *  after the node is retired, so it never races with the node's own
+ *  links that readers may still follow.
+ */
+struct epoch_hook {
+  epoch_hook *retired_next = nullptr;
+};
+
+/*
+ *  Epoch-based reclamation of the nodes of a lock-free container.
+ *
+ *  A thread that reads shared nodes holds a guard. The guard claims one
+ *  of kSlots slots and announces the global epoch in it. A node that has
+ *  been unlinked from the container is retired through the guard instead
+ *  of being freed: it goes to the slot's limbo list of the current
+ *  epoch. The epoch advances only when every busy slot has seen it, and
+ *  a node retired in epoch e is freed once the epoch reaches e + 2, when
+ *  no guard that could have seen the node is left.
+ *
+ *  Freeing is batched: a slot keeps a limbo list for each of the last
+ *  three epochs and frees a whole list when its epoch comes around again.
+ *  Every kAdvancePeriod retirements the slot tries to advance the epoch.
+ *  Nodes are destroyed and deallocated with the container's node
+ *  allocator, and the domain frees whatever is left when it is destroyed.
+ *
+ *  A thread starts with the slot picked by its hash and keeps it while
+ *  it is free, so guards of different threads rarely share a cache line.
+ */
+template <typename Node, typename Allocator = std::allocator<Node>>
+class epoch_domain final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  struct Limbo {
+    epoch_hook *head = nullptr;
+    uint64_t epoch = 0;
+  };
+
+  // A guard announces (epoch << 1) | 1 in a slot while it is active.
+  struct alignas(kCacheLineSize) Slot {
+    std::atomic<uint64_t> state{0};
+    Limbo limbo[3];
+    size_t retired = 0;
+  };
+
+ public:
+  using allocator_type = Allocator;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, Node>::value,
+                "epoch_domain: allocator value_type must be Node");
+  static_assert(std::is_base_of<epoch_hook, Node>::value,
+                "epoch_domain: Node must derive from epoch_hook");
+
+  static constexpr size_type kSlots = 64;
+  // Retirements in a slot between attempts to advance the epoch.
+  static constexpr size_type kAdvancePeriod = 64;
+
+  /*
+   *  Scope in which the nodes of the domain may be read.
+   */
+  class guard final {
+   public:
+    explicit guard(epoch_domain &domain) noexcept
+        : domain_(&domain), slot_(domain.enter()) {}
+    guard(const guard &) = delete;
+    guard &operator=(const guard &) = delete;
+    ~guard(void) { domain_->leave(slot_); }
+
+    /*
+     *  Hand over a node that is no longer reachable from the container.
+     *  It is destroyed and deallocated when no guard can see it.
+     */
+    void retire(Node *node) noexcept { domain_->retire(slot_, node); }
+
+   private:
+    epoch_domain *domain_;
+    Slot *slot_;
+  };
+
+  epoch_domain(void) : epoch_domain(allocator_type()) {}
+  explicit epoch_domain(const allocator_type &alloc)
+      : allocator_(alloc), epoch_(0) {}
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+  ~epoch_domain(void);
+
+  allocator_type get_allocator(void) const noexcept { return allocator_; }
+
+ private:
+  Slot *enter(void) noexcept;
+  void leave(Slot *slot) noexcept;
+  void retire(Slot *slot, Node *node) noexcept;
+  void try_advance(void) noexcept;
+  void free_limbo(Limbo *limbo) noexcept;
+  static size_type slot_hint(void) noexcept;
+
+ private:
+  allocator_type allocator_;
+  alignas(kCacheLineSize) std::atomic<uint64_t> epoch_;
+  Slot slots_[kSlots];
+};
+
+/*
+ *  No guard may be active any more.
+ */
+template <typename N, typename A>
+epoch_domain<N, A>::~epoch_domain(void) {
+  for (Slot &slot : slots_) {
+    for (Limbo &limbo : slot.limbo) {
+      free_limbo(&limbo);
+    }
+  }
+}
+
+/*
+ *  Claim a free slot and announce the current epoch in it. The
+ *  announcement is checked against the epoch again, so the guard never
+ *  runs with an epoch older than the last completed advance.
+ */
+template <typename N, typename A>
+typename epoch_domain<N, A>::Slot *epoch_domain<N, A>::enter(void) noexcept {
+  size_type index = slot_hint();
+  uint64_t epoch = epoch_.load();
+  uint64_t free = 0;
+  while (!slots_[index].state.compare_exchange_weak(free, epoch << 1 | 1)) {
+    free = 0;
+    index = (index + 1) % kSlots;
+    CpuRelax();
+  }
+  Slot *slot = &slots_[index];
+  for (uint64_t current = epoch_.load(); current != epoch;
+       current = epoch_.load()) {
+    epoch = current;
+    slot->state.store(epoch << 1 | 1);
+  }
+  return slot;
+}
+
+template <typename N, typename A>
+inline void epoch_domain<N, A>::leave(Slot *slot) noexcept {
+  slot->state.store(0, std::memory_order_release);
+}
+
+/*
+ *  Queue the node in the limbo list of the current epoch. The list of
+ *  that epoch modulo 3 belonged to epoch - 3 or earlier and is freed
+ *  first.
+ */
+template <typename N, typename A>
+void epoch_domain<N, A>::retire(Slot *slot, N *node) noexcept {
+  uint64_t epoch = epoch_.load();
+  Limbo &limbo = slot->limbo[epoch % 3];
+  if (limbo.epoch != epoch) {
+    free_limbo(&limbo);
+    limbo.epoch = epoch;
+  }
+  epoch_hook *hook = node;
+  hook->retired_next = limbo.head;
+  limbo.head = hook;
+  if (++slot->retired % kAdvancePeriod == 0) {
+    try_advance();
+  }
+}
+
+/*
+ *  Move the epoch forward if every busy slot has announced it.
+ */
+template <typename N, typename A>
+void epoch_domain<N, A>::try_advance(void) noexcept {
+  uint64_t epoch = epoch_.load();
+  for (const Slot &slot : slots_) {
+    uint64_t state = slot.state.load();
+    if ((state & 1) != 0 && state >> 1 != epoch) {
+      return;
+    }
+  }
+  epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+/*
+ *  Destroy and deallocate the nodes of a limbo list.
+ */
+template <typename N, typename A>
+void epoch_domain<N, A>::free_limbo(Limbo *limbo) noexcept {
+  epoch_hook *hook = limbo->head;
+  while (hook != nullptr) {
+    epoch_hook *next = hook->retired_next;
+    N *node = static_cast<N *>(hook);
+    AllocTraits::destroy(allocator_, node);
+    AllocTraits::deallocate(allocator_, node, 1);
+    hook = next;
+  }
+  limbo->head = nullptr;
+}
+
+/*
+ *  The first slot a thread tries.
+ */
+template <typename N, typename A>
+inline typename epoch_domain<N, A>::size_type epoch_domain<N, A>::slot_hint(
+    void) noexcept {
+  static thread_local size_type hint =
+      std::hash<std::thread::id>()(std::this_thread::get_id()) % kSlots;
+  return hint;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_EPOCH_H_
@@ -0,0 +1,327 @@
+#ifndef INCLUDE_S21_INDEXED_HEAP_H_
+#define INCLUDE_S21_INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <utility>
+
+#include "s21_utils.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+ *  Min-heap of keys with priorities that can be changed in place, for
+ *  timers and shortest path searches. top is the key with the least
+ *  priority by Compare.
+ *
+ *  push returns a handle that names the entry until it is popped or
+ *  erased. decrease_key, increase_key and erase take a handle and cost
+ *  O(log n), without allocating.
+ *
+ *  The heap array holds only priorities and handles, so sifting compares
+ *  and moves small entries. A side vector maps every handle to its heap
+ *  position and is updated on each move. Keys stay in a vector indexed
+ *  by handle and never move. Handles of removed entries are reused, and
+ *  a removed key is kept until its handle is reused or the heap cleared.
+ */
+template <typename Key, typename Priority, typename Compare = Less<Priority>,
+          size_t Arity = 2>
+class indexed_heap final {
+ public:
+  using key_type = Key;
+  using priority_type = Priority;
+  using value_compare = Compare;
+  using size_type = size_t;
+  using handle = size_t;
+
+  static_assert(Arity >= 2, "indexed_heap: Arity must be at least 2");
+
+  // The position of a handle that names no entry.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  indexed_heap(void) : compare_() {}
+  explicit indexed_heap(const value_compare &compare) : compare_(compare) {}
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  void reserve(size_type count);
+
+  handle top(void) const;
+  const key_type &top_key(void) const;
+  const priority_type &top_priority(void) const;
+
+  bool contains(handle h) const noexcept;
+  const key_type &key(handle h) const;
+  const priority_type &priority(handle h) const;
+
+  handle push(key_type key, priority_type priority);
+  void pop(void);
+  void erase(handle h);
+  void decrease_key(handle h, priority_type priority);
+  void increase_key(handle h, priority_type priority);
+  void update(handle h, priority_type priority);
+  void clear(void) noexcept;
+
+#ifdef DEBUG
+
+ public:
+  bool verify(void) const;
+
+#endif  // DEBUG
+
+ private:
+  struct Entry {
+    priority_type priority;
+    handle owner;
+  };
+
+  void remove_at(size_type index);
+  void sift_up(size_type hole, Entry &&entry);
+  void sift_down(size_type hole, Entry &&entry);
+  void place(size_type index, Entry &&entry);
+
+ private:
+  vector<Entry> heap_;
+  vector<size_type> position_;
+  vector<key_type> keys_;
+  vector<handle> free_;
+  value_compare compare_;
+};
+
+// CAPACITY
+
+template <typename K, typename P, typename C, size_t A>
+inline bool indexed_heap<K, P, C, A>::empty(void) const noexcept {
+  return heap_.empty();
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline typename indexed_heap<K, P, C, A>::size_type
+indexed_heap<K, P, C, A>::size(void) const noexcept {
+  return heap_.size();
+}
+
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::reserve(size_type count) {
+  heap_.reserve(count);
+  position_.reserve(count);
+  keys_.reserve(count);
+  free_.reserve(position_.capacity());
+}
+
+// ELEMENT ACCESS
+
+template <typename K, typename P, typename C, size_t A>
+inline typename indexed_heap<K, P, C, A>::handle indexed_heap<K, P, C, A>::top(
+    void) const {
+  return heap_[0].owner;
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline const K &indexed_heap<K, P, C, A>::top_key(void) const {
+  return keys_[heap_[0].owner];
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline const P &indexed_heap<K, P, C, A>::top_priority(void) const {
+  return heap_[0].priority;
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline bool indexed_heap<K, P, C, A>::contains(handle h) const noexcept {
+  return h < position_.size() && position_[h] != npos;
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline const K &indexed_heap<K, P, C, A>::key(handle h) const {
+  return keys_[h];
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline const P &indexed_heap<K, P, C, A>::priority(handle h) const {
+  return heap_[position_[h]].priority;
+}
+
+// MODIFIERS
+
+/*
+ *  Add key with priority and return its handle. The heap is unchanged
+ *  if an allocation or the key throws.
+ */
+template <typename K, typename P, typename C, size_t A>
+typename indexed_heap<K, P, C, A>::handle indexed_heap<K, P, C, A>::push(
+    key_type key, priority_type priority) {
+  handle h = free_.empty() ? keys_.size() : free_.back();
+  heap_.push_back(Entry{std::move(priority), h});
+  try {
+    if (h == keys_.size()) {
+      position_.push_back(npos);
+      // Room for every handle to be freed, so erase never allocates.
+      free_.reserve(position_.capacity());
+      keys_.push_back(std::move(key));
+    } else {
+      keys_[h] = std::move(key);
+      free_.pop_back();
+    }
+  } catch (...) {
+    if (position_.size() > keys_.size()) {
+      position_.pop_back();
+    }
+    heap_.pop_back();
+    throw;
+  }
+  Entry entry = std::move(heap_.back());
+  sift_up(heap_.size() - 1, std::move(entry));
+  return h;
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline void indexed_heap<K, P, C, A>::pop(void) {
+  remove_at(0);
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline void indexed_heap<K, P, C, A>::erase(handle h) {
+  remove_at(position_[h]);
+}
+
+/*
+ *  Give h a priority that is not greater than the current one.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::decrease_key(handle h, priority_type priority) {
+  sift_up(position_[h], Entry{std::move(priority), h});
+}
+
+/*
+ *  Give h a priority that is not less than the current one.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::increase_key(handle h, priority_type priority) {
+  sift_down(position_[h], Entry{std::move(priority), h});
+}
+
+/*
+ *  Give h any priority.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::update(handle h, priority_type priority) {
+  if (compare_(priority, heap_[position_[h]].priority)) {
+    decrease_key(h, std::move(priority));
+  } else {
+    increase_key(h, std::move(priority));
+  }
+}
+
+/*
+ *  Remove every entry. All handles become free.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::clear(void) noexcept {
+  heap_.clear();
+  position_.clear();
+  keys_.clear();
+  free_.clear();
+}
+
+#ifdef DEBUG
+
+/*
+ *  Check the heap order and that positions and heap entries agree.
+ */
+template <typename K, typename P, typename C, size_t A>
+bool indexed_heap<K, P, C, A>::verify(void) const {
+  for (size_type i = 1; i < heap_.size(); ++i) {
+    if (compare_(heap_[i].priority, heap_[(i - 1) / A].priority)) {
+      return false;
+    }
+  }
+  size_type live = 0;
+  for (handle h = 0; h < position_.size(); ++h) {
+    if (position_[h] != npos) {
+      if (position_[h] >= heap_.size() || heap_[position_[h]].owner != h) {
+        return false;
+      }
+      ++live;
+    }
+  }
+  return live == heap_.size() && live + free_.size() == position_.size();
+}
+
+#endif  // DEBUG
+
+// Support functions
+
+/*
+ *  Remove the entry at index and free its handle, into room that push
+ *  reserved. The last entry fills the hole and is sifted whichever way
+ *  it needs to go.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::remove_at(size_type index) {
+  handle h = heap_[index].owner;
+  free_.push_back(h);
+  position_[h] = npos;
+  Entry last = std::move(heap_.back());
+  heap_.pop_back();
+  if (index == heap_.size()) {
+    return;
+  }
+  if (index > 0 && compare_(last.priority, heap_[(index - 1) / A].priority)) {
+    sift_up(index, std::move(last));
+  } else {
+    sift_down(index, std::move(last));
+  }
+}
+
+/*
+ *  Move entry up from the hole at index while it is less than the parent
+ *  of the hole. entry must not refer into the heap.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::sift_up(size_type hole, Entry &&entry) {
+  while (hole > 0) {
+    size_type parent = (hole - 1) / A;
+    if (!compare_(entry.priority, heap_[parent].priority)) {
+      break;
+    }
+    place(hole, std::move(heap_[parent]));
+    hole = parent;
+  }
+  place(hole, std::move(entry));
+}
+
+/*
+ *  Move entry down from the hole at index while some child of the hole
+ *  is less, promoting the least child each time. entry must not refer
+ *  into the heap.
+ */
+template <typename K, typename P, typename C, size_t A>
+void indexed_heap<K, P, C, A>::sift_down(size_type hole, Entry &&entry) {
+  size_type n = heap_.size();
+  for (size_type first = hole * A + 1; first < n; first = hole * A + 1) {
+    size_type last = n - first < A ? n : first + A;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (compare_(heap_[child].priority, heap_[best].priority)) {
+        best = child;
+      }
+    }
+    if (!compare_(heap_[best].priority, entry.priority)) {
+      break;
+    }
+    place(hole, std::move(heap_[best]));
+    hole = best;
+  }
+  place(hole, std::move(entry));
+}
+
+template <typename K, typename P, typename C, size_t A>
+inline void indexed_heap<K, P, C, A>::place(size_type index, Entry &&entry) {
+  position_[entry.owner] = index;
+  heap_[index] = std::move(entry);
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_INDEXED_HEAP_H_
@@ -0,0 +1,632 @@
+#ifndef INCLUDE_S21_INTRUSIVE_LIST_H_
+#define INCLUDE_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list.h"
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Links of an object in an intrusive_list, embedded in the object.
+ *  A copied hook starts unlinked and assigning a hook keeps its links,
+ *  so copying an object never copies its place in a list.
+ */
+struct list_hook {
+  list_hook *prev = nullptr;
+  list_hook *next = nullptr;
+
+  list_hook(void) noexcept = default;
+  list_hook(const list_hook &) noexcept {}
+  list_hook &operator=(const list_hook &) noexcept { return *this; }
+
+  bool is_linked(void) const noexcept { return next != nullptr; }
+};
+
+/*
+ *  The object whose Hook member is hook. T must not reach the hook
+ *  through a virtual base.
+ */
+template <typename T, list_hook T::*Hook>
+inline T *HookOwner(const list_hook *hook) noexcept {
+  std::aligned_storage_t<sizeof(T), alignof(T)> probe;
+  const T *object = reinterpret_cast<const T *>(&probe);
+  std::ptrdiff_t offset = reinterpret_cast<const char *>(&(object->*Hook)) -
+                          reinterpret_cast<const char *>(object);
+  return reinterpret_cast<T *>(
+      reinterpret_cast<char *>(const_cast<list_hook *>(hook)) - offset);
+}
+
+template <typename T, list_hook T::*Hook>
+class IntrusiveListIterator;
+
+template <typename T, list_hook T::*Hook>
+class IntrusiveListConstIterator;
+
+template <typename T, list_hook T::*Hook>
+class intrusive_list;
+
+// INTRUSIVE_LIST_ITERATOR_BASE, INTRUSIVE_LIST_ITERATOR,
+// INTRUSIVE_LIST_CONST_ITERATOR
+
+template <typename T, list_hook T::*Hook>
+class IntrusiveListIteratorBase {
+ public:
+  explicit IntrusiveListIteratorBase(list_hook *node) : node_(node) {}
+
+  void increment(void) { node_ = node_->next; }
+
+  void decrement(void) { node_ = node_->prev; }
+
+  T *owner(void) const { return HookOwner<T, Hook>(node_); }
+
+  template <typename U, list_hook U::*H>
+  friend bool operator==(const IntrusiveListIteratorBase<U, H> &lhs,
+                         const IntrusiveListIteratorBase<U, H> &rhs);
+
+ protected:
+  ~IntrusiveListIteratorBase(void) {}
+
+ protected:
+  list_hook *node_;
+};
+
+template <typename T, list_hook T::*Hook>
+inline bool operator==(const IntrusiveListIteratorBase<T, Hook> &lhs,
+                       const IntrusiveListIteratorBase<T, Hook> &rhs) {
+  return lhs.node_ == rhs.node_;
+}
+
+template <typename T, list_hook T::*Hook>
+inline bool operator!=(const IntrusiveListIteratorBase<T, Hook> &lhs,
+                       const IntrusiveListIteratorBase<T, Hook> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, list_hook T::*Hook>
+class IntrusiveListIterator final : public IntrusiveListIteratorBase<T, Hook> {
+  using Base = IntrusiveListIteratorBase<T, Hook>;
+
+ public:
+  friend intrusive_list<T, Hook>;
+  friend IntrusiveListConstIterator<T, Hook>;
+
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+
+  IntrusiveListIterator(void) : Base(nullptr) {}
+
+  explicit IntrusiveListIterator(list_hook *node) : Base(node) {}
+
+  IntrusiveListIterator &operator++(void) {
+    Base::increment();
+    return *this;
+  }
+
+  IntrusiveListIterator operator++(int) {
+    IntrusiveListIterator tmp{*this};
+    Base::increment();
+    return tmp;
+  }
+
+  IntrusiveListIterator &operator--(void) {
+    Base::decrement();
+    return *this;
+  }
+
+  IntrusiveListIterator operator--(int) {
+    IntrusiveListIterator tmp{*this};
+    Base::decrement();
+    return tmp;
+  }
+
+  T &operator*(void) const { return *Base::owner(); }
+
+  T *operator->(void) const { return Base::owner(); }
+};
+
+template <typename T, list_hook T::*Hook>
+class IntrusiveListConstIterator final
+    : public IntrusiveListIteratorBase<T, Hook> {
+  using Base = IntrusiveListIteratorBase<T, Hook>;
+
+ public:
+  friend intrusive_list<T, Hook>;
+
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using pointer = const T *;
+  using reference = const T &;
+
+  IntrusiveListConstIterator(void) : Base(nullptr) {}
+
+  explicit IntrusiveListConstIterator(list_hook *node) : Base(node) {}
+
+  IntrusiveListConstIterator(const IntrusiveListIterator<T, Hook> &other)
+      : Base(other.node_) {}
+
+  IntrusiveListConstIterator &operator++(void) {
+    Base::increment();
+    return *this;
+  }
+
+  IntrusiveListConstIterator operator++(int) {
+    IntrusiveListConstIterator tmp{*this};
+    Base::increment();
+    return tmp;
+  }
+
+  IntrusiveListConstIterator &operator--(void) {
+    Base::decrement();
+    return *this;
+  }
+
+  IntrusiveListConstIterator operator--(int) {
+    IntrusiveListConstIterator tmp{*this};
+    Base::decrement();
+    return tmp;
+  }
+
+  const T &operator*(void) const { return *Base::owner(); }
+
+  const T *operator->(void) const { return Base::owner(); }
+};
+
+// INTRUSIVE_LIST
+
+/*
+ *  Doubly linked list of objects that carry their own links in a
+ *  list_hook member, as in
+ *
+ *    struct Timer {
+ *      list_hook hook;
+ *      ...
+ *    };
+ *    intrusive_list<Timer, &Timer::hook> timers;
+ *
+ *  The list never allocates, copies or destroys its elements: it links
+ *  objects that live somewhere else, which must stay in place while
+ *  they are linked. An object may be in as many lists at once as it has
+ *  hooks. erase(object) unlinks an object in O(1) without a search.
+ *
+ *  Splice, merge and reverse share their relinking with s21::list.
+ *  Unlinked hooks are reset, so is_linked tells whether an object is in
+ *  a list; destroying or clearing the list unlinks every object.
+ */
+template <typename T, list_hook T::*Hook>
+class intrusive_list final {
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = IntrusiveListIterator<T, Hook>;
+  using const_iterator = IntrusiveListConstIterator<T, Hook>;
+  using size_type = size_t;
+
+ public:
+  intrusive_list(void) noexcept;
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) noexcept;
+  ~intrusive_list(void);
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) noexcept;
+
+ public:
+  reference front(void);
+  reference back(void);
+  const_reference front(void) const;
+  const_reference back(void) const;
+
+ public:
+  iterator begin(void) noexcept;
+  const_iterator begin(void) const noexcept;
+  iterator end(void) noexcept;
+  const_iterator end(void) const noexcept;
+  const_iterator cbegin(void) const noexcept;
+  const_iterator cend(void) const noexcept;
+  iterator iterator_to(reference value) noexcept;
+  const_iterator iterator_to(const_reference value) const noexcept;
+
+ public:
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+
+ public:
+  void clear(void) noexcept;
+  iterator insert(const_iterator pos, reference value) noexcept;
+  iterator erase(const_iterator pos) noexcept;
+  void erase(reference value) noexcept;
+  void push_back(reference value) noexcept;
+  void pop_back(void) noexcept;
+  void push_front(reference value) noexcept;
+  void pop_front(void) noexcept;
+  void swap(intrusive_list &other) noexcept;
+  void merge(intrusive_list &other);
+  template <typename Compare>
+  void merge(intrusive_list &other, Compare comp);
+  void splice(const_iterator pos, intrusive_list &other) noexcept;
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator it) noexcept;
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator first, const_iterator last) noexcept;
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator first, const_iterator last,
+              size_type n) noexcept;
+  void reverse(void) noexcept;
+  template <typename Predicate>
+  size_type remove_if(Predicate pred);
+
+ private:
+  list_hook *sentinel(void) const noexcept;
+  static void Unlink(list_hook *node) noexcept;
+  static void MoveRing(list_hook *from, list_hook *to) noexcept;
+
+ private:
+  list_hook head_;
+  size_type size_;
+};
+
+// intrusive_list: ctors, dtor, overloading operator=.
+
+template <typename T, list_hook T::*H>
+intrusive_list<T, H>::intrusive_list(void) noexcept : size_(0) {
+  head_.prev = &head_;
+  head_.next = &head_;
+}
+
+template <typename T, list_hook T::*H>
+intrusive_list<T, H>::intrusive_list(intrusive_list &&other) noexcept
+    : intrusive_list() {
+  swap(other);
+}
+
+template <typename T, list_hook T::*H>
+intrusive_list<T, H>::~intrusive_list(void) {
+  clear();
+}
+
+/*
+ *  Take the objects of other; the objects of this list are unlinked.
+ */
+template <typename T, list_hook T::*H>
+intrusive_list<T, H> &intrusive_list<T, H>::operator=(
+    intrusive_list &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+// intrusive_list: element access
+
+template <typename T, list_hook T::*H>
+inline T &intrusive_list<T, H>::front(void) {
+  return *HookOwner<T, H>(head_.next);
+}
+
+template <typename T, list_hook T::*H>
+inline T &intrusive_list<T, H>::back(void) {
+  return *HookOwner<T, H>(head_.prev);
+}
+
+template <typename T, list_hook T::*H>
+inline const T &intrusive_list<T, H>::front(void) const {
+  return *HookOwner<T, H>(head_.next);
+}
+
+template <typename T, list_hook T::*H>
+inline const T &intrusive_list<T, H>::back(void) const {
+  return *HookOwner<T, H>(head_.prev);
+}
+
+// intrusive_list: iterators
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::iterator intrusive_list<T, H>::begin(
+    void) noexcept {
+  return iterator(head_.next);
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::const_iterator
+intrusive_list<T, H>::begin(void) const noexcept {
+  return const_iterator(head_.next);
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::iterator intrusive_list<T, H>::end(
+    void) noexcept {
+  return iterator(&head_);
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::const_iterator intrusive_list<T, H>::end(
+    void) const noexcept {
+  return const_iterator(sentinel());
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::const_iterator
+intrusive_list<T, H>::cbegin(void) const noexcept {
+  return begin();
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::const_iterator
+intrusive_list<T, H>::cend(void) const noexcept {
+  return end();
+}
+
+/*
+ *  The iterator to an object of this list, found in O(1).
+ */
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::iterator
+intrusive_list<T, H>::iterator_to(reference value) noexcept {
+  return iterator(&(value.*H));
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::const_iterator
+intrusive_list<T, H>::iterator_to(const_reference value) const noexcept {
+  return const_iterator(const_cast<list_hook *>(&(value.*H)));
+}
+
+// intrusive_list: capacity
+
+template <typename T, list_hook T::*H>
+inline bool intrusive_list<T, H>::empty(void) const noexcept {
+  return head_.next == &head_;
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::size_type intrusive_list<T, H>::size(
+    void) const noexcept {
+  return size_;
+}
+
+// intrusive_list: modifiers
+
+template <typename T, list_hook T::*H>
+void intrusive_list<T, H>::clear(void) noexcept {
+  list_hook *node = head_.next;
+  while (node != &head_) {
+    list_hook *next = node->next;
+    Unlink(node);
+    node = next;
+  }
+  head_.prev = &head_;
+  head_.next = &head_;
+  size_ = 0;
+}
+
+/*
+ *  Link value before pos. value must not be in a list through this hook.
+ */
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::iterator intrusive_list<T, H>::insert(
+    const_iterator pos, reference value) noexcept {
+  list_hook *node = &(value.*H);
+  node->prev = pos.node_->prev;
+  node->next = pos.node_;
+  pos.node_->prev->next = node;
+  pos.node_->prev = node;
+  ++size_;
+  return iterator(node);
+}
+
+template <typename T, list_hook T::*H>
+inline typename intrusive_list<T, H>::iterator intrusive_list<T, H>::erase(
+    const_iterator pos) noexcept {
+  list_hook *node = pos.node_;
+  list_hook *next = node->next;
+  node->prev->next = next;
+  next->prev = node->prev;
+  Unlink(node);
+  --size_;
+  return iterator(next);
+}
+
+/*
+ *  Unlink an object of this list.
+ */
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::erase(reference value) noexcept {
+  erase(iterator_to(value));
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::push_back(reference value) noexcept {
+  insert(end(), value);
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::pop_back(void) noexcept {
+  erase(const_iterator(head_.prev));
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::push_front(reference value) noexcept {
+  insert(begin(), value);
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::pop_front(void) noexcept {
+  erase(begin());
+}
+
+/*
+ *  The objects point at the sentinel of their list, so the rings are
+ *  moved from one sentinel to another through a third one.
+ */
+template <typename T, list_hook T::*H>
+void intrusive_list<T, H>::swap(intrusive_list &other) noexcept {
+  list_hook tmp;
+  MoveRing(&head_, &tmp);
+  MoveRing(&other.head_, &head_);
+  MoveRing(&tmp, &other.head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::merge(intrusive_list &other) {
+  merge(other, Less<T>());
+}
+
+/*
+ *  Move the objects of other into this list. Both lists must be sorted
+ *  by comp; equal objects of this list stay before those of other.
+ */
+template <typename T, list_hook T::*H>
+template <typename Compare>
+void intrusive_list<T, H>::merge(intrusive_list &other, Compare comp) {
+  if (this == &other) {
+    return;
+  }
+  list_hook *node = head_.next;
+  list_hook *node_other = other.head_.next;
+  // The counts follow every transfer, so they stay right if comp throws.
+  while (node != &head_ && node_other != &other.head_) {
+    if (comp(*HookOwner<T, H>(node_other), *HookOwner<T, H>(node))) {
+      list_hook *next = node_other->next;
+      ListTransfer(node, node_other, next);
+      node_other = next;
+      ++size_;
+      --other.size_;
+    } else {
+      node = node->next;
+    }
+  }
+  ListTransfer(&head_, node_other, &other.head_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::splice(const_iterator pos,
+                                         intrusive_list &other) noexcept {
+  if (this != &other) {
+    splice(pos, other, other.begin(), other.end(), other.size_);
+  }
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::splice(const_iterator pos,
+                                         intrusive_list &other,
+                                         const_iterator it) noexcept {
+  const_iterator last = it;
+  splice(pos, other, it, ++last, 1);
+}
+
+/*
+ *  Move [first, last) of other before pos. The range is counted if it
+ *  comes from another list.
+ */
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::splice(const_iterator pos,
+                                         intrusive_list &other,
+                                         const_iterator first,
+                                         const_iterator last) noexcept {
+  size_type n = 0;
+  if (this != &other) {
+    for (const_iterator it = first; it != last; ++it) {
+      ++n;
+    }
+  }
+  splice(pos, other, first, last, n);
+}
+
+/*
+ *  Move [first, last) of other before pos in O(1). n must be the length
+ *  of the range and is not checked.
+ */
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::splice(const_iterator pos,
+                                         intrusive_list &other,
+                                         const_iterator first,
+                                         const_iterator last,
+                                         size_type n) noexcept {
+  ListTransfer(pos.node_, first.node_, last.node_);
+  if (this != &other) {
+    size_ += n;
+    other.size_ -= n;
+  }
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::reverse(void) noexcept {
+  ListReverse(&head_);
+}
+
+/*
+ *  Unlink the objects that satisfy the predicate in one sweep.
+ *  Returns the number of unlinked objects.
+ */
+template <typename T, list_hook T::*H>
+template <typename Predicate>
+typename intrusive_list<T, H>::size_type intrusive_list<T, H>::remove_if(
+    Predicate pred) {
+  size_type count = 0;
+  list_hook *node = head_.next;
+  while (node != &head_) {
+    list_hook *next = node->next;
+    if (pred(*HookOwner<T, H>(node))) {
+      node->prev->next = next;
+      next->prev = node->prev;
+      Unlink(node);
+      --size_;  // kept exact in case pred throws
+      ++count;
+    }
+    node = next;
+  }
+  return count;
+}
+
+// intrusive_list: auxiliary private member functions.
+
+/*
+ *  The sentinel for const member functions, whose iterators hold
+ *  mutable links.
+ */
+template <typename T, list_hook T::*H>
+inline list_hook *intrusive_list<T, H>::sentinel(void) const noexcept {
+  return const_cast<list_hook *>(&head_);
+}
+
+template <typename T, list_hook T::*H>
+inline void intrusive_list<T, H>::Unlink(list_hook *node) noexcept {
+  node->prev = nullptr;
+  node->next = nullptr;
+}
+
+/*
+ *  Hang the ring of the sentinel from onto the sentinel to and leave from
+ *  empty. to must not be in a ring.
+ */
+template <typename T, list_hook T::*H>
+void intrusive_list<T, H>::MoveRing(list_hook *from, list_hook *to) noexcept {
+  if (from->next == from) {
+    to->prev = to;
+    to->next = to;
+    return;
+  }
+  to->prev = from->prev;
+  to->next = from->next;
+  to->prev->next = to;
+  to->next->prev = to;
+  from->prev = from;
+  from->next = from;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_INTRUSIVE_LIST_H_
@@ -3,10 +3,16 @@
 #ifndef INCLUDE_S21_LIST_H_
 #define INCLUDE_S21_LIST_H_
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utils.h"
 
 namespace s21 {
 
@@ -22,7 +28,7 @@ class ListIterator;
 template <typename T>
 class ListConstIterator;
 
-template <typename T>
+template <typename T, typename Allocator>
 class list;
 
 // LIST NODE
@@ -34,6 +40,41 @@ struct ListNode final {
   T value;
 };
 
+// LIST ALGORITHMS
+
+/*
+ *  Relinking shared by list and intrusive_list. Node is any type with
+ *  prev and next links; every ring is closed by a sentinel node.
+ *
+ *  ListTransfer moves the nodes [first, last) before position, which must
+ *  not be in the range. The range may come from the same ring or from
+ *  another one.
+ */
+template <typename Node>
+void ListTransfer(Node *position, Node *first, Node *last) noexcept {
+  if (first != last && position != first && position != last) {
+    Node *tmp = position->prev;
+    last->prev->next = position;
+    first->prev->next = last;
+    position->prev->next = first;
+    position->prev = last->prev;
+    last->prev = first->prev;
+    first->prev = tmp;
+  }
+}
+
+/*
+ *  Reverse the ring closed by head.
+ */
+template <typename Node>
+void ListReverse(Node *head) noexcept {
+  Node *node = head;
+  do {
+    std::swap(node->prev, node->next);
+    node = node->prev;
+  } while (node != head);
+}
+
 // LIST_ITERATOR_BASE, LIST_ITERATOR, LIST_CONST_ITERATOR
 
 template <typename T>
@@ -71,7 +112,8 @@ inline bool operator!=(const ListIteratorBase<T> &lhs,
 template <typename T>
 class ListIterator final : public ListIteratorBase<T> {
  public:
-  friend list<T>;
+  template <typename, typename>
+  friend class list;
   friend ListConstIterator<T>;
 
   using difference_type = std::ptrdiff_t;
@@ -132,7 +174,8 @@ class ListIterator final : public ListIteratorBase<T> {
 template <typename T>
 class ListConstIterator final : public ListIteratorBase<T> {
  public:
-  friend list<T>;
+  template <typename, typename>
+  friend class list;
 
   using difference_type = ptrdiff_t;
   using iterator_category = std::bidirectional_iterator_tag;
@@ -169,7 +212,7 @@ class ListConstIterator final : public ListIteratorBase<T> {
   }
 
   ListConstIterator operator++(int) {
-    ListIterator tmp{*this};
+    ListConstIterator tmp{*this};
     ListIteratorBase<T>::increment();
     return tmp;
   }
@@ -192,25 +235,112 @@ class ListConstIterator final : public ListIteratorBase<T> {
 
 // LIST
 
-template <typename T>
+/*
+ *  Doubly linked list with a head sentinel.
+ *
+ *  Nodes come one by one from the allocator unless the list opts in to a
+ *  node pool with reserve_nodes. The pool takes nodes from the allocator
+ *  in chunks and keeps erased nodes on a free list for reuse, so a list
+ *  that churns elements stops allocating once the pool is big enough.
+ *  Pooled memory goes back on shrink and when the list is destroyed.
+ *
+ *  The pool belongs to the nodes: swap and move carry it along, copies
+ *  start without one. Copy assignment keeps the pool of the target
+ *  unless a propagating allocator replaces the one it came from. Pooled
+ *  nodes never move to another list, splice and merge move the values
+ *  out of a pooled list instead.
+ *
+ *  The list counts its elements, so size is O(1). Splicing a range from
+ *  another list has to count the range unless the caller passes its
+ *  length.
+ *
+ *  sort merges the nodes in place on short lists. From kSortBufferMin
+ *  elements on it sorts an array of node pointers instead and relinks
+ *  the nodes once. Small trivially copyable values are copied into the
+ *  array with their node pointers, so the merge passes compare values
+ *  in contiguous memory instead of following scattered nodes; other
+ *  values still do, and use the array only for very long lists.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
 class list final {
+ private:
+  using NodeAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ListNode<T>>;
+  using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+  struct NodeChunk {
+    NodeChunk *next;
+    ListNode<T> *nodes;
+    size_t count;
+    size_t unused;
+  };
+
+  struct NodePool {
+    ListNode<T> *free = nullptr;
+    size_t free_count = 0;
+    NodeChunk *chunks = nullptr;
+    size_t capacity = 0;
+    // Some nodes of the list or of the free list are not in a chunk.
+    bool mixed = false;
+  };
+
+  using ChunkAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<NodeChunk>;
+  using ChunkAllocTraits = std::allocator_traits<ChunkAllocator>;
+  using PoolAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<NodePool>;
+  using PoolAllocTraits = std::allocator_traits<PoolAllocator>;
+
+  // A sort buffer entry that keeps a copy of a small value next to its
+  // node, so that comparisons do not touch the nodes.
+  struct SortKey {
+    T value;
+    ListNode<T> *node;
+  };
+
+  using SortEntry =
+      std::conditional_t<std::is_trivially_copyable<T>::value &&
+                             sizeof(T) <= 2 * sizeof(void *),
+                         SortKey, ListNode<T> *>;
+  using SortAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          SortEntry>;
+  using SortAllocTraits = std::allocator_traits<SortAllocator>;
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = value_type &;
   using const_reference = const value_type &;
   using iterator = ListIterator<T>;
   using const_iterator = ListConstIterator<T>;
   using size_type = size_t;
 
+  // Without cached values the buffer pays off only for huge lists.
+  static constexpr size_type kSortBufferMin =
+      std::is_same<SortEntry, SortKey>::value ? 1024 : 1 << 21;
+
+  static_assert(std::is_same<typename NodeAllocTraits::pointer,
+                             ListNode<T> *>::value,
+                "list: allocator must use raw pointers");
+
  public:
   list(void);
-  explicit list(size_type n);
-  list(const std::initializer_list<value_type> &items);
+  explicit list(const allocator_type &alloc);
+  explicit list(size_type n, const allocator_type &alloc = allocator_type());
+  list(const std::initializer_list<value_type> &items,
+       const allocator_type &alloc = allocator_type());
   list(const list &other);
+  list(const list &other, const allocator_type &alloc);
   list(list &&other);
+  list(list &&other, const allocator_type &alloc);
   ~list(void);
   list &operator=(const list &other);
-  list &operator=(list &&other) noexcept;
+  list &operator=(list &&other) noexcept(
+      NodeAllocTraits::propagate_on_container_move_assignment::value ||
+      NodeAllocTraits::is_always_equal::value);
+
+  allocator_type get_allocator(void) const noexcept;
 
  public:
   reference front(void);
@@ -230,21 +360,45 @@ class list final {
   bool empty(void) const noexcept;
   size_type size(void) const noexcept;
   size_type max_size(void) const noexcept;
+  void reserve_nodes(size_type n);
+  void shrink(void);
 
  public:
   void clear(void);
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   void pop_back(void);
   void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
   void pop_front(void);
   void swap(list &other) noexcept;
   void merge(list &other);
+  template <typename Compare>
+  void merge(list &other, Compare comp);
   void splice(const_iterator pos, list &other);
+  void splice(const_iterator pos, list &other, const_iterator it);
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last);
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last, size_type n);
   void reverse(void);
   void unique(void);
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate pred);
+  template <typename Predicate>
+  size_type remove_if(Predicate pred);
   void sort(void);
+  template <typename Compare>
+  void sort(Compare comp);
 
  public:
   template <typename... Args>
@@ -255,83 +409,348 @@ class list final {
   void insert_many_front(Args &&...args);
 
  private:
+  ListNode<T> *CreateHead(void);
+  template <typename... Args>
   ListNode<T> *CreateNode(ListNode<T> *prev, ListNode<T> *next,
-                          const value_type &value);
+                          Args &&...args);
   void DestroyNode(ListNode<T> *node);
+  template <typename... Args>
+  ListNode<T> *InsertNode(ListNode<T> *pos, Args &&...args);
+  ListNode<T> *AllocateNode(void);
+  void DeallocateNode(ListNode<T> *node) noexcept;
+  void AddChunk(size_type count);
+  NodeChunk *FindChunk(const ListNode<T> *node) const noexcept;
+  void ReleasePool(void) noexcept;
+  void AdoptNodes(list &other);
   void Transfer(iterator position, iterator first, iterator last);
+  void SwapHeads(list &other) noexcept;
+  template <typename Compare>
+  static void MergeChains(ListNode<T> *&into, ListNode<T> *second,
+                          Compare &comp);
+  static ListNode<T> *JoinChains(ListNode<T> *first, ListNode<T> *second);
+  void LinkChain(ListNode<T> *chain) noexcept;
+  template <typename Compare>
+  void SortChains(Compare &comp);
+  template <typename Compare>
+  bool SortBuffer(Compare &comp);
+  template <typename Compare>
+  static void MergeRuns(SortEntry *first, SortEntry *middle, SortEntry *last,
+                        SortEntry *out, Compare &comp);
+  static const T &SortValue(const SortKey &entry) noexcept;
+  static const T &SortValue(ListNode<T> *node) noexcept;
+  static ListNode<T> *SortNode(const SortKey &entry) noexcept;
+  static ListNode<T> *SortNode(ListNode<T> *node) noexcept;
 
  private:
+  static constexpr size_type kMinPoolChunk = 16;
+  static constexpr size_type kSortRun = 16;
+
+  NodeAllocator node_allocator_;
   ListNode<T> *head_;
+  size_type size_;
+  NodePool *pool_;
 };
 
 // list: auxiliary private member functions.
 
-template <typename T>
-ListNode<T> *list<T>::CreateNode(ListNode<T> *prev, ListNode<T> *next,
-                                 const T &value) {
-  ListNode<T> *node =
-      static_cast<ListNode<T> *>(operator new(sizeof(ListNode<T>)));
+/*
+ *  The head sentinel holds no value, only the links are initialized.
+ */
+template <typename T, typename A>
+ListNode<T> *list<T, A>::CreateHead(void) {
+  ListNode<T> *head = NodeAllocTraits::allocate(node_allocator_, 1);
+  head->prev = head;
+  head->next = head;
+
+  return head;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+ListNode<T> *list<T, A>::CreateNode(ListNode<T> *prev, ListNode<T> *next,
+                                    Args &&...args) {
+  ListNode<T> *node = AllocateNode();
   node->prev = prev;
   node->next = next;
   try {
-    new (&node->value) T(value);
-  } catch (std::exception &e) {
-    operator delete(node);
-    throw e;
+    NodeAllocTraits::construct(node_allocator_, &node->value,
+                               std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateNode(node);
+    throw;
   }
 
   return node;
 }
 
-template <typename T>
-void list<T>::DestroyNode(ListNode<T> *node) {
-  node->value.~T();
-  operator delete(static_cast<void *>(node));
+template <typename T, typename A>
+void list<T, A>::DestroyNode(ListNode<T> *node) {
+  NodeAllocTraits::destroy(node_allocator_, &node->value);
+  DeallocateNode(node);
 }
 
 /*
- *  Transfer
- *  Move the sublist from the first to the last not inclusive [first, last)
- *  and insert before the position iterator
+ *  Create a node from args, link it before pos and count it.
  */
-template <typename T>
-void list<T>::Transfer(iterator position, iterator first, iterator last) {
-  if (position != first && position != last) {
-    ListNode<T> *tmp = position.node_->prev;
-    last.node_->prev->next = position.node_;
-    first.node_->prev->next = last.node_;
-    position.node_->prev->next = first.node_;
-    position.node_->prev = last.node_->prev;
-    last.node_->prev = first.node_->prev;
-    first.node_->prev = tmp;
+template <typename T, typename A>
+template <typename... Args>
+inline ListNode<T> *list<T, A>::InsertNode(ListNode<T> *pos,
+                                           Args &&...args) {
+  ListNode<T> *node =
+      CreateNode(pos->prev, pos, std::forward<Args>(args)...);
+  pos->prev->next = node;
+  pos->prev = node;
+  ++size_;
+
+  return node;
+}
+
+/*
+ *  Take a node from the pool, growing it by a chunk as large as the pool
+ *  if it is used up, or from the allocator if the list has no pool.
+ */
+template <typename T, typename A>
+inline ListNode<T> *list<T, A>::AllocateNode(void) {
+  if (pool_ == nullptr) {
+    return NodeAllocTraits::allocate(node_allocator_, 1);
+  }
+  if (pool_->free == nullptr) {
+    AddChunk(pool_->capacity < kMinPoolChunk ? kMinPoolChunk
+                                             : pool_->capacity);
+  }
+  ListNode<T> *node = pool_->free;
+  pool_->free = node->next;
+  --pool_->free_count;
+  return node;
+}
+
+template <typename T, typename A>
+inline void list<T, A>::DeallocateNode(ListNode<T> *node) noexcept {
+  if (pool_ == nullptr) {
+    NodeAllocTraits::deallocate(node_allocator_, node, 1);
+    return;
+  }
+  node->next = pool_->free;
+  pool_->free = node;
+  ++pool_->free_count;
+}
+
+/*
+ *  Allocate count nodes in one piece and put them on the free list.
+ */
+template <typename T, typename A>
+void list<T, A>::AddChunk(size_type count) {
+  ChunkAllocator chunk_allocator(node_allocator_);
+  NodeChunk *chunk = ChunkAllocTraits::allocate(chunk_allocator, 1);
+  ListNode<T> *nodes;
+  try {
+    nodes = NodeAllocTraits::allocate(node_allocator_, count);
+  } catch (...) {
+    ChunkAllocTraits::deallocate(chunk_allocator, chunk, 1);
+    throw;
+  }
+  ChunkAllocTraits::construct(chunk_allocator, chunk,
+                              NodeChunk{pool_->chunks, nodes, count, 0});
+  pool_->chunks = chunk;
+  pool_->capacity += count;
+  for (size_type i = count; i-- > 0;) {
+    nodes[i].next = pool_->free;
+    pool_->free = &nodes[i];
+  }
+  pool_->free_count += count;
+}
+
+/*
+ *  The chunk that holds the node, nullptr for a node from the allocator.
+ */
+template <typename T, typename A>
+typename list<T, A>::NodeChunk *list<T, A>::FindChunk(
+    const ListNode<T> *node) const noexcept {
+  std::less<const ListNode<T> *> less;
+  for (NodeChunk *chunk = pool_->chunks; chunk != nullptr;
+       chunk = chunk->next) {
+    if (!less(node, chunk->nodes) && less(node, chunk->nodes + chunk->count)) {
+      return chunk;
+    }
+  }
+  return nullptr;
+}
+
+/*
+ *  Give the free nodes, the chunks and the pool back to the allocator.
+ *  Every node of the list must be on the free list.
+ */
+template <typename T, typename A>
+void list<T, A>::ReleasePool(void) noexcept {
+  if (pool_->mixed) {
+    for (ListNode<T> *node = pool_->free; node != nullptr;) {
+      ListNode<T> *next = node->next;
+      if (FindChunk(node) == nullptr) {
+        NodeAllocTraits::deallocate(node_allocator_, node, 1);
+      }
+      node = next;
+    }
+  }
+  ChunkAllocator chunk_allocator(node_allocator_);
+  for (NodeChunk *chunk = pool_->chunks; chunk != nullptr;) {
+    NodeChunk *next = chunk->next;
+    NodeAllocTraits::deallocate(node_allocator_, chunk->nodes, chunk->count);
+    ChunkAllocTraits::destroy(chunk_allocator, chunk);
+    ChunkAllocTraits::deallocate(chunk_allocator, chunk, 1);
+    chunk = next;
+  }
+  PoolAllocator pool_allocator(node_allocator_);
+  PoolAllocTraits::destroy(pool_allocator, pool_);
+  PoolAllocTraits::deallocate(pool_allocator, pool_, 1);
+  pool_ = nullptr;
+}
+
+/*
+ *  Called before the nodes of other are linked into this list. A pooled
+ *  other keeps its nodes: its values are moved to new unpooled nodes
+ *  first. Unpooled nodes make the pools of both lists mixed.
+ */
+template <typename T, typename A>
+void list<T, A>::AdoptNodes(list &other) {
+  if (other.pool_ != nullptr) {
+    list tmp(get_allocator());
+    for (iterator it = other.begin(), last = other.end(); it != last; ++it) {
+      tmp.InsertNode(tmp.head_, std::move(*it));
+    }
+    other.clear();
+    std::swap(other.head_, tmp.head_);
+    std::swap(other.size_, tmp.size_);
+    // Nodes left in other, say by a throwing comparator, go to its pool.
+    if (!other.empty()) {
+      other.pool_->mixed = true;
+    }
+  }
+  if (pool_ != nullptr && !other.empty()) {
+    pool_->mixed = true;
+  }
+}
+
+/*
+ *  Move the sublist [first, last) before position.
+ */
+template <typename T, typename A>
+inline void list<T, A>::Transfer(iterator position, iterator first,
+                                 iterator last) {
+  ListTransfer(position.node_, first.node_, last.node_);
+}
+
+/*
+ *  Exchange the nodes, their count and their pools, but not the
+ *  allocators.
+ */
+template <typename T, typename A>
+inline void list<T, A>::SwapHeads(list &other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(pool_, other.pool_);
+}
+
+/*
+ *  Merge the sorted null-terminated chain second into the sorted chain
+ *  into, both linked by next pointers. Equal values of into go first.
+ *  If comp throws, into holds every node of both chains in no
+ *  particular order.
+ */
+template <typename T, typename A>
+template <typename Compare>
+void list<T, A>::MergeChains(ListNode<T> *&into, ListNode<T> *second,
+                             Compare &comp) {
+  ListNode<T> *first = into;
+  ListNode<T> *result = nullptr;
+  ListNode<T> **tail = &result;
+  try {
+    while (first != nullptr && second != nullptr) {
+      if (comp(second->value, first->value)) {
+        *tail = second;
+        second = second->next;
+      } else {
+        *tail = first;
+        first = first->next;
+      }
+      tail = &(*tail)->next;
+    }
+  } catch (...) {
+    *tail = JoinChains(first, second);
+    into = result;
+    throw;
+  }
+  *tail = (first != nullptr) ? first : second;
+  into = result;
+}
+
+/*
+ *  Append the null-terminated chain second to first.
+ */
+template <typename T, typename A>
+ListNode<T> *list<T, A>::JoinChains(ListNode<T> *first, ListNode<T> *second) {
+  if (first == nullptr) {
+    return second;
+  }
+  ListNode<T> *last = first;
+  while (last->next != nullptr) {
+    last = last->next;
   }
+  last->next = second;
+  return first;
+}
+
+/*
+ *  Make the null-terminated chain the elements of the list, restoring
+ *  the prev links.
+ */
+template <typename T, typename A>
+void list<T, A>::LinkChain(ListNode<T> *chain) noexcept {
+  ListNode<T> *prev = head_;
+  for (ListNode<T> *node = chain; node != nullptr; node = node->next) {
+    prev->next = node;
+    node->prev = prev;
+    prev = node;
+  }
+  prev->next = head_;
+  head_->prev = prev;
 }
 
 // list: ctors, dtor, overloading operator=.
 
-template <typename T>
-list<T>::list(void) : head_(nullptr) {
-  head_ = static_cast<ListNode<T> *>(operator new(sizeof(ListNode<T>)));
-  head_->prev = head_;
-  head_->next = head_;
+template <typename T, typename A>
+list<T, A>::list(void) : list(allocator_type()) {}
+
+template <typename T, typename A>
+list<T, A>::list(const allocator_type &alloc)
+    : node_allocator_(alloc), head_(nullptr), size_(0), pool_(nullptr) {
+  head_ = CreateHead();
 }
 
-template <typename T>
-list<T>::list(typename list<T>::size_type n) : list() {
+template <typename T, typename A>
+list<T, A>::list(size_type n, const allocator_type &alloc) : list(alloc) {
   for (size_t i = 0; i < n; ++i) {
     push_back(value_type());
   }
 }
 
-template <typename T>
-list<T>::list(const std::initializer_list<T> &items) : list() {
+template <typename T, typename A>
+list<T, A>::list(const std::initializer_list<T> &items,
+                 const allocator_type &alloc)
+    : list(alloc) {
   for (const T &item : items) {
     push_back(item);
   }
 }
 
-template <typename T>
-list<T>::list(const list &other) : list() {
+template <typename T, typename A>
+list<T, A>::list(const list &other)
+    : list(other, allocator_type(
+                      NodeAllocTraits::select_on_container_copy_construction(
+                          other.node_allocator_))) {}
+
+template <typename T, typename A>
+list<T, A>::list(const list &other, const allocator_type &alloc)
+    : list(alloc) {
   const_iterator it = other.cbegin();
   const_iterator last = other.cend();
   while (it != last) {
@@ -340,117 +759,253 @@ list<T>::list(const list &other) : list() {
   }
 }
 
-template <typename T>
-list<T>::list(list<T> &&other) : list() {
-  swap(other);
+/*
+ *  The allocator is copied, not moved, so that the other list can still
+ *  release the head it gets in exchange.
+ */
+template <typename T, typename A>
+list<T, A>::list(list &&other)
+    : list(allocator_type(other.node_allocator_)) {
+  SwapHeads(other);
 }
 
-template <typename T>
-inline list<T> &list<T>::operator=(const list &other) {
+template <typename T, typename A>
+list<T, A>::list(list &&other, const allocator_type &alloc) : list(alloc) {
+  if (NodeAllocTraits::is_always_equal::value ||
+      node_allocator_ == other.node_allocator_) {
+    SwapHeads(other);
+  } else {
+    for (iterator it = other.begin(), last = other.end(); it != last; ++it) {
+      InsertNode(head_, std::move(*it));
+    }
+    other.clear();
+  }
+}
+
+/*
+ *  Copy assignment. The copy is built with the allocator of the other list
+ *  if it propagates on copy assignment. A pooled list that keeps its
+ *  allocator returns its nodes to the pool and copies into pooled nodes.
+ */
+template <typename T, typename A>
+inline list<T, A> &list<T, A>::operator=(const list &other) {
   if (this != &other) {
-    list tmp(other);
-    swap(tmp);
+    constexpr bool kPropagate =
+        NodeAllocTraits::propagate_on_container_copy_assignment::value;
+    if (pool_ != nullptr &&
+        (!kPropagate || node_allocator_ == other.node_allocator_)) {
+      clear();
+      for (const_reference value : other) {
+        InsertNode(head_, value);
+      }
+      return *this;
+    }
+    list tmp(other, allocator_type(kPropagate ? other.node_allocator_
+                                              : node_allocator_));
+    if constexpr (kPropagate) {
+      std::swap(node_allocator_, tmp.node_allocator_);
+    }
+    SwapHeads(tmp);
   }
   return *this;
 }
 
-template <typename T>
-inline list<T> &list<T>::operator=(list &&other) noexcept {
-  if (this != &other) {
-    swap(other);
+/*
+ *  Move assignment. The nodes are exchanged if the allocator propagates
+ *  or the allocators are equal, otherwise the values are moved one by one.
+ */
+template <typename T, typename A>
+inline list<T, A> &list<T, A>::operator=(list &&other) noexcept(
+    NodeAllocTraits::propagate_on_container_move_assignment::value ||
+    NodeAllocTraits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+
+  if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::
+                    value) {
+    std::swap(node_allocator_, other.node_allocator_);
+    SwapHeads(other);
+  } else if (NodeAllocTraits::is_always_equal::value ||
+             node_allocator_ == other.node_allocator_) {
+    SwapHeads(other);
+  } else {
+    clear();
+    for (iterator it = other.begin(), last = other.end(); it != last; ++it) {
+      InsertNode(head_, std::move(*it));
+    }
+    other.clear();
   }
   return *this;
 }
 
-template <typename T>
-list<T>::~list(void) {
+template <typename T, typename A>
+list<T, A>::~list(void) {
   clear();
-  operator delete(head_);
+  if (pool_ != nullptr) {
+    ReleasePool();
+  }
+  NodeAllocTraits::deallocate(node_allocator_, head_, 1);
+}
+
+template <typename T, typename A>
+inline typename list<T, A>::allocator_type list<T, A>::get_allocator(
+    void) const noexcept {
+  return allocator_type(node_allocator_);
 }
 
 // list: element access
 
-template <typename T>
-inline T &list<T>::front(void) {
+template <typename T, typename A>
+inline T &list<T, A>::front(void) {
   return head_->next->value;
 }
 
-template <typename T>
-inline const T &list<T>::front(void) const {
+template <typename T, typename A>
+inline const T &list<T, A>::front(void) const {
   return head_->next->value;
 }
 
-template <typename T>
-inline T &list<T>::back(void) {
+template <typename T, typename A>
+inline T &list<T, A>::back(void) {
   return head_->prev->value;
 }
 
-template <typename T>
-inline const T &list<T>::back(void) const {
+template <typename T, typename A>
+inline const T &list<T, A>::back(void) const {
   return head_->prev->value;
 }
 
 // list: iterators
 
-template <typename T>
-inline ListIterator<T> list<T>::begin(void) noexcept {
+template <typename T, typename A>
+inline ListIterator<T> list<T, A>::begin(void) noexcept {
   return iterator(head_->next);
 }
 
-template <typename T>
-inline ListConstIterator<T> list<T>::begin(void) const noexcept {
+template <typename T, typename A>
+inline ListConstIterator<T> list<T, A>::begin(void) const noexcept {
   return const_iterator(head_->next);
 }
 
-template <typename T>
-inline ListIterator<T> list<T>::end(void) noexcept {
+template <typename T, typename A>
+inline ListIterator<T> list<T, A>::end(void) noexcept {
   return iterator(head_);
 }
 
-template <typename T>
-inline ListConstIterator<T> list<T>::end(void) const noexcept {
+template <typename T, typename A>
+inline ListConstIterator<T> list<T, A>::end(void) const noexcept {
   return const_iterator(head_);
 }
 
-template <typename T>
-inline ListConstIterator<T> list<T>::cbegin(void) const noexcept {
+template <typename T, typename A>
+inline ListConstIterator<T> list<T, A>::cbegin(void) const noexcept {
   return const_iterator{head_->next};
 }
 
-template <typename T>
-inline ListConstIterator<T> list<T>::cend(void) const noexcept {
+template <typename T, typename A>
+inline ListConstIterator<T> list<T, A>::cend(void) const noexcept {
   return const_iterator{head_};
 }
 
 // list: capacity
 
-template <typename T>
-inline bool list<T>::empty(void) const noexcept {
+template <typename T, typename A>
+inline bool list<T, A>::empty(void) const noexcept {
   return head_ == head_->next;
 }
 
-template <typename T>
-inline size_t list<T>::size(void) const noexcept {
-  size_t n = 0;
-  for (const_iterator it = cbegin(), last = cend(); it != last; ++it) {
-    ++n;
-  }
-  return n;
+template <typename T, typename A>
+inline size_t list<T, A>::size(void) const noexcept {
+  return size_;
 }
 
-template <typename T>
-inline size_t list<T>::max_size(void) const noexcept {
+template <typename T, typename A>
+inline size_t list<T, A>::max_size(void) const noexcept {
   /*
    *  return std::numeric_limits<size_type>::max() / 2 / sizeof(ListNode<T>);
    */
 
-  return std::allocator<ListNode<T>>().max_size();
+  return NodeAllocTraits::max_size(node_allocator_);
+}
+
+/*
+ *  Switch the node pool on and make sure that n more elements can be
+ *  inserted without allocating.
+ */
+template <typename T, typename A>
+void list<T, A>::reserve_nodes(size_type n) {
+  if (pool_ == nullptr) {
+    PoolAllocator pool_allocator(node_allocator_);
+    NodePool *pool = PoolAllocTraits::allocate(pool_allocator, 1);
+    PoolAllocTraits::construct(pool_allocator, pool);
+    pool->mixed = !empty();
+    pool_ = pool;
+  }
+  if (pool_->free_count < n) {
+    AddChunk(n - pool_->free_count);
+  }
+}
+
+/*
+ *  Give the unused memory of the pool back to the allocator: free nodes
+ *  that came from the allocator one by one and chunks with no element.
+ *  The pool stays switched on.
+ */
+template <typename T, typename A>
+void list<T, A>::shrink(void) {
+  if (pool_ == nullptr) {
+    return;
+  }
+  for (NodeChunk *chunk = pool_->chunks; chunk != nullptr;
+       chunk = chunk->next) {
+    chunk->unused = 0;
+  }
+  ListNode<T> *kept = nullptr;
+  for (ListNode<T> *node = pool_->free; node != nullptr;) {
+    ListNode<T> *next = node->next;
+    NodeChunk *chunk = FindChunk(node);
+    if (chunk == nullptr) {
+      NodeAllocTraits::deallocate(node_allocator_, node, 1);
+      --pool_->free_count;
+    } else {
+      ++chunk->unused;
+      node->next = kept;
+      kept = node;
+    }
+    node = next;
+  }
+  pool_->free = nullptr;
+  for (ListNode<T> *node = kept; node != nullptr;) {
+    ListNode<T> *next = node->next;
+    NodeChunk *chunk = FindChunk(node);
+    if (chunk->unused != chunk->count) {
+      node->next = pool_->free;
+      pool_->free = node;
+    }
+    node = next;
+  }
+  ChunkAllocator chunk_allocator(node_allocator_);
+  for (NodeChunk **link = &pool_->chunks; *link != nullptr;) {
+    NodeChunk *chunk = *link;
+    if (chunk->unused == chunk->count) {
+      *link = chunk->next;
+      pool_->capacity -= chunk->count;
+      pool_->free_count -= chunk->count;
+      NodeAllocTraits::deallocate(node_allocator_, chunk->nodes,
+                                  chunk->count);
+      ChunkAllocTraits::destroy(chunk_allocator, chunk);
+      ChunkAllocTraits::deallocate(chunk_allocator, chunk, 1);
+    } else {
+      link = &chunk->next;
+    }
+  }
 }
 
 // list: modifiers
 
-template <typename T>
-inline void list<T>::clear(void) {
+template <typename T, typename A>
+inline void list<T, A>::clear(void) {
   ListNode<T> *node = head_->next;
   while (node != head_) {
     ListNode<T> *tmp = node;
@@ -459,62 +1014,120 @@ inline void list<T>::clear(void) {
   }
   head_->next = head_;
   head_->prev = head_;
+  size_ = 0;
 }
 
-template <typename T>
-inline typename list<T>::iterator list<T>::insert(iterator pos,
-                                                  const_reference value) {
-  ListNode<T> *node = CreateNode(pos.node_->prev, pos.node_, value);
-  pos.node_->prev->next = node;
-  pos.node_->prev = node;
+template <typename T, typename A>
+inline typename list<T, A>::iterator list<T, A>::insert(
+    iterator pos, const_reference value) {
+  return iterator(InsertNode(pos.node_, value));
+}
 
-  return iterator(node);
+template <typename T, typename A>
+inline typename list<T, A>::iterator list<T, A>::insert(iterator pos,
+                                                        value_type &&value) {
+  return iterator(InsertNode(pos.node_, std::move(value)));
 }
 
-template <typename T>
-inline void list<T>::erase(typename list<T>::iterator pos) {
+/*
+ *  Construct an element in place before pos.
+ */
+template <typename T, typename A>
+template <typename... Args>
+inline typename list<T, A>::iterator list<T, A>::emplace(const_iterator pos,
+                                                         Args &&...args) {
+  return iterator(InsertNode(pos.node_, std::forward<Args>(args)...));
+}
+
+template <typename T, typename A>
+inline void list<T, A>::erase(iterator pos) {
   ListNode<T> *node = pos.node_;
   node->prev->next = node->next;
   node->next->prev = node->prev;
   DestroyNode(node);
+  --size_;
 }
 
-template <typename T>
-inline void list<T>::push_back(const T &value) {
-  insert(end(), value);
+template <typename T, typename A>
+inline void list<T, A>::push_back(const T &value) {
+  InsertNode(head_, value);
 }
 
-template <typename T>
-inline void list<T>::pop_back(void) {
+template <typename T, typename A>
+inline void list<T, A>::push_back(value_type &&value) {
+  InsertNode(head_, std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+inline typename list<T, A>::reference list<T, A>::emplace_back(
+    Args &&...args) {
+  return InsertNode(head_, std::forward<Args>(args)...)->value;
+}
+
+template <typename T, typename A>
+inline void list<T, A>::pop_back(void) {
   erase(--end());
 }
 
-template <typename T>
-inline void list<T>::push_front(const T &value) {
-  insert(begin(), value);
+template <typename T, typename A>
+inline void list<T, A>::push_front(const T &value) {
+  InsertNode(head_->next, value);
 }
 
-template <typename T>
-inline void list<T>::pop_front(void) {
+template <typename T, typename A>
+inline void list<T, A>::push_front(value_type &&value) {
+  InsertNode(head_->next, std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+inline typename list<T, A>::reference list<T, A>::emplace_front(
+    Args &&...args) {
+  return InsertNode(head_->next, std::forward<Args>(args)...)->value;
+}
+
+template <typename T, typename A>
+inline void list<T, A>::pop_front(void) {
   erase(begin());
 }
 
-template <typename T>
-inline void list<T>::swap(list<T> &other) noexcept {
-  std::swap(head_, other.head_);
+template <typename T, typename A>
+inline void list<T, A>::swap(list &other) noexcept {
+  if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+    std::swap(node_allocator_, other.node_allocator_);
+  }
+  SwapHeads(other);
 }
 
-template <typename T>
-inline void list<T>::merge(list<T> &other) {
+template <typename T, typename A>
+inline void list<T, A>::merge(list &other) {
+  merge(other, Less<T>());
+}
+
+/*
+ *  Move the elements of other into this list. Both lists must be sorted
+ *  by comp; equal elements of this list stay before those of other.
+ */
+template <typename T, typename A>
+template <typename Compare>
+void list<T, A>::merge(list &other, Compare comp) {
+  if (this == &other) {
+    return;
+  }
+  AdoptNodes(other);
   iterator it = begin();
   iterator last = end();
   iterator it_other = other.begin();
   iterator last_other = other.end();
 
+  // The counts follow every transfer, so they stay right if comp throws.
   while (it != last && it_other != last_other) {
-    if (*it_other < *it) {
+    if (comp(*it_other, *it)) {
       iterator cur = it_other++;
       Transfer(it, cur, it_other);
+      ++size_;
+      --other.size_;
     } else {
       ++it;
     }
@@ -522,29 +1135,96 @@ inline void list<T>::merge(list<T> &other) {
   if (it_other != last_other) {
     Transfer(last, it_other, last_other);
   }
+  size_ += other.size_;
+  other.size_ = 0;
 }
 
-template <typename T>
-inline void list<T>::splice(const_iterator pos, list &other) {
+template <typename T, typename A>
+inline void list<T, A>::splice(const_iterator pos, list &other) {
+  if (this == &other) {
+    return;
+  }
+  AdoptNodes(other);
   Transfer(iterator{pos.node_}, other.begin(), other.end());
+  size_ += other.size_;
+  other.size_ = 0;
 }
 
-template <typename T>
-inline void list<T>::reverse(void) {
-  ListNode<T> *node = head_;
-  do {
-    std::swap(node->prev, node->next);
-    node = node->prev;
-  } while (node != head_);
+template <typename T, typename A>
+inline void list<T, A>::splice(const_iterator pos, list &other,
+                               const_iterator it) {
+  const_iterator last = it;
+  splice(pos, other, it, ++last, 1);
 }
 
-template <typename T>
-inline void list<T>::unique(void) {
+/*
+ *  Move [first, last) of other before pos. The range is counted if it
+ *  comes from another list.
+ */
+template <typename T, typename A>
+inline void list<T, A>::splice(const_iterator pos, list &other,
+                               const_iterator first, const_iterator last) {
+  size_type n = 0;
+  if (this != &other) {
+    for (const_iterator it = first; it != last; ++it) {
+      ++n;
+    }
+  }
+  splice(pos, other, first, last, n);
+}
+
+/*
+ *  Move [first, last) of other before pos in O(1). n must be the length
+ *  of the range and is not checked. The values of a pooled other are
+ *  moved into new nodes one by one.
+ */
+template <typename T, typename A>
+void list<T, A>::splice(const_iterator pos, list &other,
+                        const_iterator first, const_iterator last,
+                        size_type n) {
+  if (this == &other) {
+    Transfer(iterator(pos.node_), iterator(first.node_),
+             iterator(last.node_));
+    return;
+  }
+  if (other.pool_ != nullptr) {
+    while (first != last) {
+      const_iterator it = first++;
+      InsertNode(pos.node_, std::move(it.node_->value));
+      other.erase(iterator(it.node_));
+    }
+    return;
+  }
+  if (pool_ != nullptr && n != 0) {
+    pool_->mixed = true;
+  }
+  Transfer(iterator(pos.node_), iterator(first.node_), iterator(last.node_));
+  size_ += n;
+  other.size_ -= n;
+}
+
+template <typename T, typename A>
+inline void list<T, A>::reverse(void) {
+  ListReverse(head_);
+}
+
+template <typename T, typename A>
+inline void list<T, A>::unique(void) {
+  unique(std::equal_to<T>());
+}
+
+/*
+ *  Erase every element for which pred(previous, element) holds, where
+ *  previous is the last element kept before it.
+ */
+template <typename T, typename A>
+template <typename BinaryPredicate>
+void list<T, A>::unique(BinaryPredicate pred) {
   iterator it = begin();
   iterator last = end();
   iterator next = it;
   while (++next != last) {
-    if (*it == *next) {
+    if (pred(*it, *next)) {
       erase(next);
       next = it;
     } else {
@@ -553,55 +1233,250 @@ inline void list<T>::unique(void) {
   }
 }
 
-template <typename T>
-inline void list<T>::sort(void) {
-  if (head_ == head_->next || head_ == head_->next->next) {
+/*
+ *  Unlink and destroy the elements that satisfy the predicate in one sweep.
+ *  Returns the number of removed elements.
+ */
+template <typename T, typename A>
+template <typename Predicate>
+typename list<T, A>::size_type list<T, A>::remove_if(Predicate pred) {
+  size_type count = 0;
+  ListNode<T> *node = head_->next;
+  while (node != head_) {
+    ListNode<T> *next = node->next;
+    if (pred(node->value)) {
+      node->prev->next = next;
+      next->prev = node->prev;
+      DestroyNode(node);
+      --size_;  // kept exact in case pred throws
+      ++count;
+    }
+    node = next;
+  }
+  return count;
+}
+
+template <typename T, typename A>
+inline void list<T, A>::sort(void) {
+  sort(Less<T>());
+}
+
+/*
+ *  Stable sort by comp. Lists of kSortBufferMin elements and more are
+ *  sorted through a pointer buffer, shorter ones and lists that cannot
+ *  get the buffer are merged in place.
+ */
+template <typename T, typename A>
+template <typename Compare>
+void list<T, A>::sort(Compare comp) {
+  if (size_ < 2) {
     return;
   }
+  if (size_ < kSortBufferMin || !SortBuffer(comp)) {
+    SortChains(comp);
+  }
+}
 
-  list hooks[64];
-  list carry;
+/*
+ *  Bottom-up merge sort on null-terminated chains, hooks[i] holds
+ *  a sorted chain of 2^i nodes. No lists and no sentinels are created,
+ *  so the allocator is never used. Every node is always in hooks or
+ *  in the unsorted rest, so if comp throws they are linked back into
+ *  the list in an unspecified order.
+ */
+template <typename T, typename A>
+template <typename Compare>
+void list<T, A>::SortChains(Compare &comp) {
+  ListNode<T> *hooks[64] = {};
   int fill_hooks = 0;
-  while (!empty()) {
-    carry.Transfer(carry.begin(), begin(), ++begin());
-    int i = 0;
-    while (i < fill_hooks && !hooks[i].empty()) {
-      hooks[i].merge(carry);
-      carry.swap(hooks[i]);
-      ++i;
+  ListNode<T> *node = head_->next;
+  head_->prev->next = nullptr;
+  try {
+    while (node != nullptr) {
+      ListNode<T> *carry = node;
+      node = node->next;
+      carry->next = nullptr;
+      int i = 0;
+      while (i < fill_hooks && hooks[i] != nullptr) {
+        MergeChains(hooks[i], carry, comp);
+        carry = hooks[i];
+        hooks[i] = nullptr;
+        ++i;
+      }
+      hooks[i] = carry;
+      if (i == fill_hooks) {
+        ++fill_hooks;
+      }
+    }
+    ListNode<T> *result = nullptr;
+    for (int i = 0; i < fill_hooks; ++i) {
+      if (hooks[i] != nullptr) {
+        if (result != nullptr) {
+          MergeChains(hooks[i], result, comp);
+        }
+        result = hooks[i];
+        hooks[i] = nullptr;
+      }
+    }
+    LinkChain(result);
+  } catch (...) {
+    for (int i = 0; i < fill_hooks; ++i) {
+      node = JoinChains(hooks[i], node);
+    }
+    LinkChain(node);
+    throw;
+  }
+}
+
+/*
+ *  Copy the nodes into a buffer of sort entries, sort it and relink the
+ *  nodes in the new order. Runs of kSortRun entries are insertion
+ *  sorted, then merged pairwise between the two halves of the buffer.
+ *  Returns false and leaves the list alone if the buffer cannot be
+ *  allocated. If comp throws, the list keeps its order.
+ */
+template <typename T, typename A>
+template <typename Compare>
+bool list<T, A>::SortBuffer(Compare &comp) {
+  SortAllocator sort_allocator(node_allocator_);
+  const size_type n = size_;
+  SortEntry *buffer;
+  try {
+    buffer = SortAllocTraits::allocate(sort_allocator, 2 * n);
+  } catch (...) {
+    return false;
+  }
+  SortEntry *src = buffer;
+  SortEntry *dst = buffer + n;
+  ListNode<T> *node = head_->next;
+  for (size_type i = 0; i < n; ++i, node = node->next) {
+    if constexpr (std::is_same<SortEntry, SortKey>::value) {
+      ::new (static_cast<void *>(src + i)) SortKey{node->value, node};
+    } else {
+      ::new (static_cast<void *>(src + i)) SortEntry(node);
+    }
+    ::new (static_cast<void *>(dst + i)) SortEntry(src[i]);
+  }
+
+  // The list is untouched until the relinking, so a throwing comp only
+  // has to give the buffer back.
+  try {
+    for (size_type first = 0; first < n; first += kSortRun) {
+      size_type last = first + kSortRun < n ? first + kSortRun : n;
+      for (size_type i = first + 1; i < last; ++i) {
+        SortEntry key = src[i];
+        size_type j = i;
+        for (; j > first && comp(SortValue(key), SortValue(src[j - 1]));
+             --j) {
+          src[j] = src[j - 1];
+        }
+        src[j] = key;
+      }
     }
-    carry.swap(hooks[i]);
-    if (i == fill_hooks) {
-      ++fill_hooks;
+    for (size_type width = kSortRun; width < n; width *= 2) {
+      for (size_type first = 0; first < n; first += 2 * width) {
+        size_type middle = first + width < n ? first + width : n;
+        size_type last = middle + width < n ? middle + width : n;
+        MergeRuns(src + first, src + middle, src + last, dst + first, comp);
+      }
+      std::swap(src, dst);
     }
+  } catch (...) {
+    SortAllocTraits::deallocate(sort_allocator, buffer, 2 * n);
+    throw;
   }
-  for (int i = 1; i < fill_hooks; ++i) {
-    hooks[i].merge(hooks[i - 1]);
+
+  ListNode<T> *prev = head_;
+  for (size_type i = 0; i < n; ++i) {
+    node = SortNode(src[i]);
+    prev->next = node;
+    node->prev = prev;
+    prev = node;
   }
-  swap(hooks[fill_hooks - 1]);
+  prev->next = head_;
+  head_->prev = prev;
+  SortAllocTraits::deallocate(sort_allocator, buffer, 2 * n);
+  return true;
 }
 
-template <typename T>
+/*
+ *  Merge the sorted runs [first, middle) and [middle, last) into out.
+ *  Equal elements of the first run go first.
+ */
+template <typename T, typename A>
+template <typename Compare>
+void list<T, A>::MergeRuns(SortEntry *first, SortEntry *middle,
+                           SortEntry *last, SortEntry *out, Compare &comp) {
+  SortEntry *right = middle;
+  while (first != middle && right != last) {
+    if (comp(SortValue(*right), SortValue(*first))) {
+      *out++ = *right++;
+    } else {
+      *out++ = *first++;
+    }
+  }
+  out = std::copy(first, middle, out);
+  std::copy(right, last, out);
+}
+
+template <typename T, typename A>
+inline const T &list<T, A>::SortValue(const SortKey &entry) noexcept {
+  return entry.value;
+}
+
+template <typename T, typename A>
+inline const T &list<T, A>::SortValue(ListNode<T> *node) noexcept {
+  return node->value;
+}
+
+template <typename T, typename A>
+inline ListNode<T> *list<T, A>::SortNode(const SortKey &entry) noexcept {
+  return entry.node;
+}
+
+template <typename T, typename A>
+inline ListNode<T> *list<T, A>::SortNode(ListNode<T> *node) noexcept {
+  return node;
+}
+
+/*
+ *  Construct the arguments in place before pos, in their order. The
+ *  elements already inserted are erased again if an exception is thrown.
+ */
+template <typename T, typename A>
 template <typename... Args>
-inline typename list<T>::iterator list<T>::insert_many(const_iterator pos,
-                                                       Args &&...args) {
-  list tmp{args...};
-  if (!tmp.empty()) {
-    Transfer(iterator(pos.node_), tmp.begin(), tmp.end());
+inline typename list<T, A>::iterator list<T, A>::insert_many(
+    const_iterator pos, Args &&...args) {
+  size_type count = 0;
+  try {
+    ((InsertNode(pos.node_, std::forward<Args>(args)), ++count), ...);
+  } catch (...) {
+    for (; count != 0; --count) {
+      erase(iterator(pos.node_->prev));
+    }
+    throw;
   }
   return iterator(pos.node_);
 }
 
-template <typename T>
+template <typename T, typename A>
 template <typename... Args>
-inline void list<T>::insert_many_back(Args &&...args) {
-  insert_many(cend(), args...);
+inline void list<T, A>::insert_many_back(Args &&...args) {
+  insert_many(cend(), std::forward<Args>(args)...);
 }
 
-template <typename T>
+template <typename T, typename A>
 template <typename... Args>
-inline void list<T>::insert_many_front(Args &&...args) {
-  insert_many(cbegin(), args...);
+inline void list<T, A>::insert_many_front(Args &&...args) {
+  insert_many(cbegin(), std::forward<Args>(args)...);
+}
+
+/*
+ *  Erase the elements that satisfy the predicate in one sweep.
+ */
+template <typename T, typename A, typename Predicate>
+typename list<T, A>::size_type erase_if(list<T, A> &lst, Predicate pred) {
+  return lst.remove_if(pred);
 }
 
 }  // namespace s21
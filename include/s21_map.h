@@ -168,6 +168,16 @@ class map final {
   BinaryTree tree_;
 };
 
+/*
+ *  Erase the elements that satisfy the predicate in one sweep.
+ */
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Predicate>
+typename map<Key, T, Compare, Allocator>::size_type erase_if(
+    map<Key, T, Compare, Allocator>& container, Predicate pred) {
+  return TreeEraseIf(container, pred);
+}
+
 }  // namespace s21
 
 #endif  // INCLUDE_S21_MAP_H_
@@ -0,0 +1,183 @@
+#ifndef INCLUDE_S21_MMAP_ALLOCATOR_H_
+#define INCLUDE_S21_MMAP_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+/*
+ *  Allocator for large buffers. Blocks of at least kMapThreshold bytes
+ *  are anonymous memory mappings, smaller ones come from operator new.
+ *  With HugePages the mappings are advised to use transparent huge pages.
+ *
+ *  reallocate() resizes a block of trivially copyable values. On Linux
+ *  a mapped block grows or shrinks with mremap, which moves page table
+ *  entries instead of copying the data. vector uses it when it is
+ *  available and the elements are bitwise copyable. On other systems
+ *  every block comes from operator new.
+ */
+template <typename T, bool HugePages = false>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  template <typename U>
+  struct rebind {
+    using other = mmap_allocator<U, HugePages>;
+  };
+
+  static constexpr size_type kMapThreshold = size_type(1) << 20;
+
+  mmap_allocator(void) noexcept = default;
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U, HugePages> &) noexcept {}
+
+  T *allocate(size_type n);
+  void deallocate(T *ptr, size_type n) noexcept;
+  T *reallocate(T *ptr, size_type old_n, size_type new_n);
+
+ private:
+  static size_type bytes(size_type n);
+  static bool is_mapped(size_type n) noexcept;
+  static size_type page_round(size_type n) noexcept;
+  static void *map(size_type n);
+};
+
+template <typename T, typename U, bool H>
+bool operator==(const mmap_allocator<T, H> &, const mmap_allocator<U, H> &) {
+  return true;
+}
+
+template <typename T, typename U, bool H>
+bool operator!=(const mmap_allocator<T, H> &, const mmap_allocator<U, H> &) {
+  return false;
+}
+
+template <typename T, bool H>
+T *mmap_allocator<T, H>::allocate(size_type n) {
+  if (is_mapped(n)) {
+    return static_cast<T *>(map(n));
+  }
+  return static_cast<T *>(::operator new(bytes(n)));
+}
+
+template <typename T, bool H>
+void mmap_allocator<T, H>::deallocate(T *ptr, size_type n) noexcept {
+#if defined(__linux__)
+  if (is_mapped(n)) {
+    ::munmap(static_cast<void *>(ptr), page_round(n));
+    return;
+  }
+#endif
+  (void)n;
+  ::operator delete(static_cast<void *>(ptr));
+}
+
+/*
+ *  Resize the block of old_n cells at ptr to new_n cells, keeping
+ *  min(old_n, new_n) values. Returns the address of the block, which
+ *  may move. The old block is left intact if an exception is thrown.
+ */
+template <typename T, bool H>
+T *mmap_allocator<T, H>::reallocate(T *ptr, size_type old_n,
+                                    size_type new_n) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_allocator: reallocate requires trivially copyable T");
+#if defined(__linux__)
+  if (is_mapped(old_n) && is_mapped(new_n)) {
+    size_type length = bytes(new_n);
+    void *moved = ::mremap(static_cast<void *>(ptr), page_round(old_n),
+                           page_round(new_n), MREMAP_MAYMOVE);
+    if (moved == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    if constexpr (H) {
+      ::madvise(moved, length, MADV_HUGEPAGE);
+    }
+    return static_cast<T *>(moved);
+  }
+#endif
+  T *new_ptr = allocate(new_n);
+  size_type kept = old_n < new_n ? old_n : new_n;
+  if (kept != 0) {
+    std::memcpy(static_cast<void *>(new_ptr), static_cast<const void *>(ptr),
+                kept * sizeof(T));
+  }
+  deallocate(ptr, old_n);
+  return new_ptr;
+}
+
+/*
+ *  Size of n cells in bytes. Sizes that can't be rounded up to whole
+ *  pages are rejected.
+ */
+template <typename T, bool H>
+typename mmap_allocator<T, H>::size_type mmap_allocator<T, H>::bytes(
+    size_type n) {
+  if (n > std::numeric_limits<size_type>::max() / 2 / sizeof(T)) {
+    throw std::bad_alloc();
+  }
+  return n * sizeof(T);
+}
+
+/*
+ *  True if a block of n cells is a memory mapping.
+ */
+template <typename T, bool H>
+bool mmap_allocator<T, H>::is_mapped(size_type n) noexcept {
+#if defined(__linux__)
+  return n != 0 && n >= kMapThreshold / sizeof(T);
+#else
+  (void)n;
+  return false;
+#endif
+}
+
+/*
+ *  Size of n cells rounded up to whole pages.
+ */
+template <typename T, bool H>
+typename mmap_allocator<T, H>::size_type mmap_allocator<T, H>::page_round(
+    size_type n) noexcept {
+#if defined(__linux__)
+  size_type page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+  return (n * sizeof(T) + page - 1) / page * page;
+#else
+  return n * sizeof(T);
+#endif
+}
+
+/*
+ *  Map anonymous memory for n cells.
+ */
+template <typename T, bool H>
+void *mmap_allocator<T, H>::map(size_type n) {
+#if defined(__linux__)
+  size_type length = bytes(n);
+  void *ptr = ::mmap(nullptr, page_round(n), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  if constexpr (H) {
+    ::madvise(ptr, length, MADV_HUGEPAGE);
+  }
+  return ptr;
+#else
+  return ::operator new(bytes(n));
+#endif
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_MMAP_ALLOCATOR_H_
@@ -0,0 +1,395 @@
+#ifndef INCLUDE_S21_MPMC_QUEUE_H_
+#define INCLUDE_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Bounded FIFO queue for any number of producer and consumer threads,
+ *  after the design of Dmitry Vyukov. Every cell carries a sequence
+ *  number that tells whose turn it is: a producer may fill the cell of
+ *  position pos when the sequence is pos, a consumer may empty it when
+ *  the sequence is pos + 1. Producers claim positions with one
+ *  compare-and-swap on tail_ and consumers with one on head_, so the two
+ *  sides contend only among themselves and never take a lock.
+ *
+ *  try_push and try_pop fail at once on a full or empty queue. push and
+ *  pop wait: they spin for a while, then yield, then sleep on a condition
+ *  variable until the other side moves its counter. The lock is touched
+ *  only when a thread is asleep.
+ *
+ *  The capacity is fixed and rounded up to a power of two. A claimed cell
+ *  must always be filled, so T must be nothrow movable.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "mpmc_queue: allocator value_type must be T");
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+                    std::is_nothrow_move_assignable<T>::value,
+                "mpmc_queue: T must be nothrow movable");
+
+  explicit mpmc_queue(size_type capacity,
+                      const allocator_type &alloc = allocator_type());
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue(void);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type capacity(void) const noexcept;
+
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(reference out) noexcept;
+
+  void push(const_reference value);
+  void push(value_type &&value);
+  template <typename... Args>
+  void emplace(Args &&...args);
+  void pop(reference out);
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value(void) noexcept {
+      return std::launder(reinterpret_cast<T *>(storage));
+    }
+  };
+
+  using CellAllocator = typename AllocTraits::template rebind_alloc<Cell>;
+  using CellTraits = std::allocator_traits<CellAllocator>;
+
+  // Spin rounds before yielding and before sleeping.
+  static constexpr int kSpinCount = 64;
+  static constexpr int kYieldCount = 16;
+
+  static size_type round_capacity(size_type n);
+  bool has_space(void) const noexcept;
+  bool has_value(void) const noexcept;
+  void wake(std::condition_variable &cond,
+            const std::atomic<int> &waiters) noexcept;
+
+ private:
+  // Shared and never written after construction.
+  allocator_type allocator_;
+  Cell *cells_;
+  size_type mask_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+
+  // Sleeping push and pop calls.
+  alignas(kCacheLineSize) std::atomic<int> push_waiters_;
+  std::atomic<int> pop_waiters_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+// Ctors, Dtor
+
+template <typename T, typename A>
+mpmc_queue<T, A>::mpmc_queue(size_type capacity, const allocator_type &alloc)
+    : allocator_(alloc),
+      cells_(nullptr),
+      mask_(round_capacity(capacity) - 1),
+      tail_(0),
+      head_(0),
+      push_waiters_(0),
+      pop_waiters_(0) {
+  CellAllocator cell_allocator(allocator_);
+  cells_ = CellTraits::allocate(cell_allocator, mask_ + 1);
+  for (size_type i = 0; i <= mask_; ++i) {
+    CellTraits::construct(cell_allocator, cells_ + i);
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+/*
+ *  No other thread may use the queue any more.
+ */
+template <typename T, typename A>
+mpmc_queue<T, A>::~mpmc_queue(void) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    AllocTraits::destroy(allocator_, cells_[i & mask_].value());
+  }
+  CellAllocator cell_allocator(allocator_);
+  for (size_type i = 0; i <= mask_; ++i) {
+    CellTraits::destroy(cell_allocator, cells_ + i);
+  }
+  CellTraits::deallocate(cell_allocator, cells_, mask_ + 1);
+}
+
+template <typename T, typename A>
+inline typename mpmc_queue<T, A>::allocator_type
+mpmc_queue<T, A>::get_allocator(void) const noexcept {
+  return allocator_;
+}
+
+// CAPACITY
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline bool mpmc_queue<T, A>::empty(void) const noexcept {
+  return size() == 0;
+}
+
+/*
+ *  A snapshot that may be stale by the time it is returned. It counts
+ *  claimed positions, so it includes values being pushed and excludes
+ *  values being popped.
+ */
+template <typename T, typename A>
+typename mpmc_queue<T, A>::size_type mpmc_queue<T, A>::size(
+    void) const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  size_type count = tail - head;
+  // head may have passed the tail read after it
+  return count > mask_ + 1 ? 0 : count;
+}
+
+template <typename T, typename A>
+inline typename mpmc_queue<T, A>::size_type mpmc_queue<T, A>::capacity(
+    void) const noexcept {
+  return mask_ + 1;
+}
+
+// NONBLOCKING MODIFIERS
+
+template <typename T, typename A>
+inline bool mpmc_queue<T, A>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T, typename A>
+inline bool mpmc_queue<T, A>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+/*
+ *  Construct an element at the end. Returns false and leaves args
+ *  untouched if the queue is full. A constructor that may throw runs
+ *  before a cell is claimed and its result is moved into the cell,
+ *  so then args are used up even if the queue is full.
+ */
+template <typename T, typename A>
+template <typename... Args>
+bool mpmc_queue<T, A>::try_emplace(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible<T, Args &&...>::value) {
+    return try_emplace(value_type(std::forward<Args>(args)...));
+  } else {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(sequence - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    AllocTraits::construct(allocator_, cell->value(),
+                           std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    wake(not_empty_, pop_waiters_);
+    return true;
+  }
+}
+
+/*
+ *  Move the front element to out and remove it.
+ *  Returns false if the queue is empty.
+ */
+template <typename T, typename A>
+bool mpmc_queue<T, A>::try_pop(reference out) noexcept {
+  size_type pos = head_.load(std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence - (pos + 1));
+    if (diff == 0) {
+      if (head_.compare_exchange_weak(pos, pos + 1)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = head_.load(std::memory_order_relaxed);
+    }
+  }
+  out = std::move(*cell->value());
+  AllocTraits::destroy(allocator_, cell->value());
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  wake(not_full_, push_waiters_);
+  return true;
+}
+
+// BLOCKING MODIFIERS
+
+template <typename T, typename A>
+inline void mpmc_queue<T, A>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T, typename A>
+inline void mpmc_queue<T, A>::push(value_type &&value) {
+  emplace(std::move(value));
+}
+
+/*
+ *  Construct an element at the end, waiting while the queue is full.
+ */
+template <typename T, typename A>
+template <typename... Args>
+void mpmc_queue<T, A>::emplace(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible<T, Args &&...>::value) {
+    emplace(value_type(std::forward<Args>(args)...));
+  } else {
+    for (;;) {
+      for (int i = 0; i < kSpinCount + kYieldCount; ++i) {
+        if (try_emplace(std::forward<Args>(args)...)) {
+          return;
+        }
+        if (i < kSpinCount) {
+          CpuRelax();
+        } else {
+          std::this_thread::yield();
+        }
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      push_waiters_.fetch_add(1);
+      not_full_.wait(lock, [this] { return has_space(); });
+      push_waiters_.fetch_sub(1);
+    }
+  }
+}
+
+/*
+ *  Move the front element to out and remove it, waiting while the queue
+ *  is empty.
+ */
+template <typename T, typename A>
+void mpmc_queue<T, A>::pop(reference out) {
+  for (;;) {
+    for (int i = 0; i < kSpinCount + kYieldCount; ++i) {
+      if (try_pop(out)) {
+        return;
+      }
+      if (i < kSpinCount) {
+        CpuRelax();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    pop_waiters_.fetch_add(1);
+    not_empty_.wait(lock, [this] { return has_value(); });
+    pop_waiters_.fetch_sub(1);
+  }
+}
+
+// Support functions
+
+/*
+ *  The smallest power of two that is not less than n and 2.
+ */
+template <typename T, typename A>
+typename mpmc_queue<T, A>::size_type mpmc_queue<T, A>::round_capacity(
+    size_type n) {
+  size_type limit = std::numeric_limits<size_type>::max() / 4 / sizeof(Cell);
+  if (n > limit) {
+    throw std::length_error("mpmc_queue: capacity is too large");
+  }
+  size_type result = 2;
+  while (result < n) {
+    result *= 2;
+  }
+  return result;
+}
+
+/*
+ *  True if a producer may claim a cell. The tail is read first, so
+ *  a stale answer can only be true.
+ */
+template <typename T, typename A>
+inline bool mpmc_queue<T, A>::has_space(void) const noexcept {
+  size_type tail = tail_.load();
+  return tail - head_.load() <= mask_;
+}
+
+/*
+ *  True if a value has been claimed by a producer and not yet by
+ *  a consumer. The head is read first, so a stale answer can only be
+ *  true. The value may still be under construction.
+ */
+template <typename T, typename A>
+inline bool mpmc_queue<T, A>::has_value(void) const noexcept {
+  size_type head = head_.load();
+  return tail_.load() != head;
+}
+
+/*
+ *  Wake a sleeper of cond after a cell has changed hands.
+ *
+ *  A sleeper registers in waiters and then checks the position counters,
+ *  the waker moves a counter and then checks waiters. All four accesses
+ *  are sequentially consistent, so at least one of them sees the other:
+ *  either the sleeper doesn't sleep or the waker notifies it. On x86
+ *  this costs nothing, the compare-and-swap on a counter is a full
+ *  barrier anyway. The lock makes sure a registered sleeper is already
+ *  waiting when it is notified.
+ */
+template <typename T, typename A>
+inline void mpmc_queue<T, A>::wake(std::condition_variable &cond,
+                                   const std::atomic<int> &waiters) noexcept {
+  if (waiters.load() != 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cond.notify_one();
+  }
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_MPMC_QUEUE_H_
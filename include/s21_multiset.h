@@ -155,6 +155,16 @@ class multiset final {
   BinaryTree tree_;
 };
 
+/*
+ *  Erase the elements that satisfy the predicate in one sweep.
+ */
+template <typename Key, typename Compare, typename Allocator,
+          typename Predicate>
+typename multiset<Key, Compare, Allocator>::size_type erase_if(
+    multiset<Key, Compare, Allocator>& container, Predicate pred) {
+  return TreeEraseIf(container, pred);
+}
+
 }  // namespace s21
 
 #endif  // INCLUDE_S21_MULTISET_H_
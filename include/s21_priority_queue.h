@@ -0,0 +1,212 @@
+#ifndef INCLUDE_S21_PRIORITY_QUEUE_H_
+#define INCLUDE_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_utils.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+ *  Max-heap adaptor over a random access container: top is the greatest
+ *  value by Compare, so std::greater-like comparators give a min-heap.
+ *  The container must provide operator[], back, push_back, emplace_back,
+ *  pop_back, empty, size and swap, as s21::vector does.
+ *
+ *  Every node has Arity children. A wider heap is shallower, so push
+ *  moves fewer values, and the children of a node share a cache line,
+ *  while pop compares Arity children per level. 4 is often faster than
+ *  2 for small values.
+ *
+ *  Sifting moves a hole instead of swapping, so each level costs one
+ *  move. A heap built from a range is made with Floyd's method in O(n).
+ */
+template <typename T, typename Container = vector<T>,
+          typename Compare = Less<T>, size_t Arity = 2>
+class priority_queue final {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
+
+  static_assert(Arity >= 2, "priority_queue: Arity must be at least 2");
+
+ public:
+  priority_queue(void) : container_(), compare_() {}
+
+  explicit priority_queue(const value_compare &compare)
+      : container_(), compare_(compare) {}
+
+  priority_queue(const value_compare &compare, const container_type &container)
+      : container_(container), compare_(compare) {
+    make_heap();
+  }
+
+  priority_queue(const value_compare &compare, container_type &&container)
+      : container_(std::move(container)), compare_(compare) {
+    make_heap();
+  }
+
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const value_compare &compare = value_compare())
+      : container_(), compare_(compare) {
+    for (; first != last; ++first) {
+      container_.push_back(*first);
+    }
+    make_heap();
+  }
+
+  priority_queue(std::initializer_list<value_type> const &items)
+      : priority_queue(items.begin(), items.end()) {}
+
+  priority_queue(const priority_queue &other)
+      : container_(other.container_), compare_(other.compare_) {}
+
+  priority_queue(priority_queue &&other) : priority_queue() { swap(other); }
+
+  priority_queue &operator=(const priority_queue &other) {
+    if (this != &other) {
+      priority_queue tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  priority_queue &operator=(priority_queue &&other) {
+    if (this != &other) {
+      swap(other);
+    }
+    return *this;
+  }
+
+ public:
+  const_reference top(void) const { return container_[0]; }
+
+ public:
+  bool empty(void) const noexcept { return container_.empty(); }
+
+  size_type size(void) const noexcept { return container_.size(); }
+
+ public:
+  void push(const_reference value) {
+    container_.push_back(value);
+    push_heap();
+  }
+
+  void push(value_type &&value) {
+    container_.push_back(std::move(value));
+    push_heap();
+  }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    container_.emplace_back(std::forward<Args>(args)...);
+    push_heap();
+  }
+
+  void pop(void) {
+    value_type last = std::move(container_.back());
+    container_.pop_back();
+    if (!container_.empty()) {
+      sift_down(0, std::move(last));
+    }
+  }
+
+  /*
+   *  Remove the top and insert value with one sift instead of two.
+   *  The usual step of a scheduler or of a k-way merge.
+   */
+  void pop_push(const_reference value) { pop_push(value_type(value)); }
+
+  void pop_push(value_type &&value) {
+    if (container_.empty()) {
+      container_.push_back(std::move(value));
+    } else {
+      sift_down(0, std::move(value));
+    }
+  }
+
+  void swap(priority_queue &other) noexcept {
+    container_.swap(other.container_);
+    std::swap(compare_, other.compare_);
+  }
+
+ private:
+  /*
+   *  Move the value appended to the container to its place.
+   */
+  void push_heap(void) {
+    value_type value = std::move(container_.back());
+    sift_up(container_.size() - 1, std::move(value));
+  }
+
+  /*
+   *  Floyd's method: sift down every parent, the last one first.
+   */
+  void make_heap(void) {
+    size_type n = container_.size();
+    if (n < 2) {
+      return;
+    }
+    for (size_type parent = (n - 2) / Arity + 1; parent-- > 0;) {
+      value_type value = std::move(container_[parent]);
+      sift_down(parent, std::move(value));
+    }
+  }
+
+  /*
+   *  Move value up from the hole at index while it is greater than the
+   *  parent of the hole. value must not refer into the container.
+   */
+  void sift_up(size_type hole, value_type &&value) {
+    while (hole > 0) {
+      size_type parent = (hole - 1) / Arity;
+      if (!compare_(container_[parent], value)) {
+        break;
+      }
+      container_[hole] = std::move(container_[parent]);
+      hole = parent;
+    }
+    container_[hole] = std::move(value);
+  }
+
+  /*
+   *  Move value down from the hole at index while some child of the
+   *  hole is greater, promoting the greatest child each time. value must
+   *  not refer into the container.
+   */
+  void sift_down(size_type hole, value_type &&value) {
+    size_type n = container_.size();
+    for (size_type first = hole * Arity + 1; first < n;
+         first = hole * Arity + 1) {
+      size_type last = n - first < Arity ? n : first + Arity;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; ++child) {
+        if (compare_(container_[best], container_[child])) {
+          best = child;
+        }
+      }
+      if (!compare_(value, container_[best])) {
+        break;
+      }
+      container_[hole] = std::move(container_[best]);
+      hole = best;
+    }
+    container_[hole] = std::move(value);
+  }
+
+ private:
+  container_type container_;
+  value_compare compare_;
+};
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_PRIORITY_QUEUE_H_
@@ -7,18 +7,31 @@
 #include <initializer_list>
 #include <utility>
 
+#include "s21_deque.h"
+
 namespace s21 {
 
-template <typename T>
+/*
+ *  FIFO adaptor over a sequence container. The container must provide
+ *  front, back, push_back, emplace_back, pop_front, empty, size and
+ *  swap, as s21::deque and s21::list do.
+ */
+template <typename T, typename Container = deque<T>>
 class queue final {
  public:
-  using value_type = T;
-  using reference = value_type &;
-  using const_reference = const value_type &;
-  using size_type = size_t;
+  using container_type = Container;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
 
  public:
-  queue(void) : head_(nullptr), tail_(nullptr) {}
+  queue(void) : container_() {}
+
+  explicit queue(const container_type &container) : container_(container) {}
+
+  explicit queue(container_type &&container)
+      : container_(std::move(container)) {}
 
   queue(const std::initializer_list<value_type> &items) : queue() {
     for (const_reference item : items) {
@@ -26,17 +39,7 @@ class queue final {
     }
   }
 
-  queue(const queue &other) : queue() {
-    QueueNode **node_ptr = &head_;
-    QueueNode *node_other = other.head_;
-    while (node_other != nullptr) {
-      QueueNode *tmp = new QueueNode{nullptr, node_other->value};
-      *node_ptr = tmp;
-      tail_ = tmp;
-      node_ptr = &tmp->next;
-      node_other = node_other->next;
-    }
-  }
+  queue(const queue &other) : container_(other.container_) {}
 
   queue(queue &&other) : queue() { swap(other); }
 
@@ -55,91 +58,54 @@ class queue final {
     return *this;
   }
 
-  ~queue(void) {
-    while (head_ != nullptr) {
-      QueueNode *tmp = head_;
-      head_ = head_->next;
-      delete tmp;
-    }
-  }
-
  public:
-  bool empty(void) const noexcept { return head_ == nullptr; }
-
-  size_type size(void) const noexcept {
-    size_type sz = 0;
-    QueueNode *node = head_;
-    while (node != nullptr) {
-      ++sz;
-      node = node->next;
-    }
-    return sz;
-  }
+  bool empty(void) const noexcept { return container_.empty(); }
+
+  size_type size(void) const noexcept { return container_.size(); }
 
  public:
-  reference front(void) { return head_->value; }
+  reference front(void) { return container_.front(); }
 
-  const_reference front(void) const { return head_->value; }
+  const_reference front(void) const { return container_.front(); }
 
-  reference back(void) { return tail_->value; }
+  reference back(void) { return container_.back(); }
 
-  const_reference back(void) const { return tail_->value; }
+  const_reference back(void) const { return container_.back(); }
 
  public:
-  void push(const_reference value) {
-    QueueNode *node = new QueueNode{nullptr, value};
-    if (tail_ == nullptr) {
-      tail_ = node;
-      head_ = node;
-    } else {
-      tail_->next = node;
-      tail_ = node;
-    }
-  }
+  void push(const_reference value) { container_.push_back(value); }
 
-  void pop(void) {
-    QueueNode *tmp = head_;
-    head_ = head_->next;
-    if (head_ == nullptr) {
-      tail_ = nullptr;
-    }
-    delete tmp;
-  }
-
-  void swap(queue &other) noexcept {
-    std::swap(head_, other.head_);
-    std::swap(tail_, other.tail_);
-  }
+  void push(value_type &&value) { container_.push_back(std::move(value)); }
 
- public:
   template <typename... Args>
-  void insert_many_back(Args &&...args) {
-    insert_many_back_aux(args...);
+  decltype(auto) emplace(Args &&...args) {
+    return container_.emplace_back(std::forward<Args>(args)...);
   }
 
- private:
-  void insert_many_back_aux(void) {}
+  void pop(void) { container_.pop_front(); }
 
-  template <typename U>
-  void insert_many_back_aux(U &&arg) {
-    push(arg);
+  void swap(queue &other) noexcept { container_.swap(other.container_); }
+
+  /*
+   *  Bulk push and pop, available when the container provides them
+   *  as s21::ring_buffer does.
+   */
+  void push_n(const value_type *values, size_type n) {
+    container_.push_n(values, n);
   }
 
-  template <typename U, typename... Args>
-  void insert_many_back_aux(U &&arg, Args &&...args) {
-    push(arg);
-    insert_many_back_aux(args...);
+  size_type pop_n(value_type *out, size_type n) {
+    return container_.pop_n(out, n);
   }
 
- private:
-  struct QueueNode {
-    QueueNode *next;
-    value_type value;
-  };
+ public:
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace(std::forward<Args>(args)), ...);
+  }
 
  private:
-  QueueNode *head_;
-  QueueNode *tail_;
+  container_type container_;
 };
 
 }  // namespace s21
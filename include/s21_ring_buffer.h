@@ -0,0 +1,514 @@
+#ifndef INCLUDE_S21_RING_BUFFER_H_
+#define INCLUDE_S21_RING_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_queue.h"
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  FIFO container in one contiguous array. The capacity is a power of two,
+ *  so a position is mapped to a cell with a mask. head_ and tail_ count
+ *  the pushed and popped elements and are allowed to wrap around, so
+ *  size() is tail_ - head_ and a full buffer is told apart from an empty one.
+ *
+ *  The array doubles when a push finds it full and never shrinks, so a
+ *  queue of steady size stops allocating after warm up. push_n and pop_n
+ *  copy whole spans, with memcpy for bitwise copyable elements.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "ring_buffer: allocator value_type must be T");
+  static_assert(std::is_same<typename AllocTraits::pointer, T *>::value,
+                "ring_buffer: allocator must use raw pointers");
+
+  ring_buffer(void);
+  explicit ring_buffer(const allocator_type &alloc);
+  ring_buffer(std::initializer_list<value_type> const &items,
+              const allocator_type &alloc = allocator_type());
+  ring_buffer(const ring_buffer &other);
+  ring_buffer(const ring_buffer &other, const allocator_type &alloc);
+  ring_buffer(ring_buffer &&other) noexcept;
+  ~ring_buffer(void);
+  ring_buffer &operator=(const ring_buffer &other);
+  ring_buffer &operator=(ring_buffer &&other) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front(void);
+  const_reference front(void) const;
+  reference back(void);
+  const_reference back(void) const;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type max_size(void) const noexcept;
+  size_type capacity(void) const noexcept;
+  void reserve(size_type n);
+
+  void clear(void) noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_front(void);
+  void push_n(const_pointer values, size_type n);
+  size_type pop_n(pointer out, size_type n);
+  void swap(ring_buffer &other) noexcept;
+
+ private:
+  // Bulk kernels bypass the allocator's construct and destroy,
+  // so they are used only when the allocator doesn't customize them.
+  static constexpr bool kBitwiseCopyable =
+      std::is_trivially_copyable<T>::value &&
+      UsesDefaultConstruct<Allocator, T>::value;
+  static constexpr bool kTriviallyDestructible =
+      std::is_trivially_destructible<T>::value &&
+      UsesDefaultConstruct<Allocator, T>::value;
+  static constexpr size_type kMinCapacity = 8;
+
+  pointer cell(size_type position) const noexcept;
+  void grow(size_type n);
+  void relocate(size_type new_capacity);
+  void release(void) noexcept;
+  void swap_data(ring_buffer &other) noexcept;
+
+ private:
+  allocator_type allocator_;
+  pointer data_;
+  size_type capacity_;
+  size_type head_;
+  size_type tail_;
+};
+
+/*
+ *  FIFO queue that never allocates in a steady state.
+ */
+template <typename T>
+using ring_queue = queue<T, ring_buffer<T>>;
+
+// Ctors, Dtor, overloaded operator=
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(void)
+    : allocator_(), data_(nullptr), capacity_(0), head_(0), tail_(0) {}
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(const allocator_type &alloc)
+    : allocator_(alloc), data_(nullptr), capacity_(0), head_(0), tail_(0) {}
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(std::initializer_list<value_type> const &items,
+                               const allocator_type &alloc)
+    : ring_buffer(alloc) {
+  push_n(items.begin(), items.size());
+}
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(const ring_buffer &other)
+    : ring_buffer(other, AllocTraits::select_on_container_copy_construction(
+                             other.allocator_)) {}
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(const ring_buffer &other,
+                               const allocator_type &alloc)
+    : ring_buffer(alloc) {
+  reserve(other.size());
+  for (size_type i = other.head_; i != other.tail_; ++i) {
+    push_back(*other.cell(i));
+  }
+}
+
+template <typename T, typename A>
+ring_buffer<T, A>::ring_buffer(ring_buffer &&other) noexcept
+    : allocator_(std::move(other.allocator_)),
+      data_(nullptr),
+      capacity_(0),
+      head_(0),
+      tail_(0) {
+  swap_data(other);
+}
+
+template <typename T, typename A>
+ring_buffer<T, A>::~ring_buffer(void) {
+  release();
+}
+
+template <typename T, typename A>
+ring_buffer<T, A> &ring_buffer<T, A>::operator=(const ring_buffer &other) {
+  if (this != &other) {
+    constexpr bool propagate =
+        AllocTraits::propagate_on_container_copy_assignment::value;
+    ring_buffer tmp(other, propagate ? other.allocator_ : allocator_);
+    release();
+    if constexpr (propagate) {
+      allocator_ = other.allocator_;
+    }
+    swap_data(tmp);
+  }
+  return *this;
+}
+
+template <typename T, typename A>
+ring_buffer<T, A> &ring_buffer<T, A>::operator=(ring_buffer &&other) noexcept(
+    AllocTraits::propagate_on_container_move_assignment::value ||
+    AllocTraits::is_always_equal::value) {
+  if (this != &other) {
+    release();
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      allocator_ = std::move(other.allocator_);
+      swap_data(other);
+    } else {
+      if (allocator_ == other.allocator_) {
+        swap_data(other);
+      } else {
+        reserve(other.size());
+        for (size_type i = other.head_; i != other.tail_; ++i) {
+          push_back(std::move(*other.cell(i)));
+        }
+        other.clear();
+      }
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::allocator_type
+ring_buffer<T, A>::get_allocator(void) const noexcept {
+  return allocator_;
+}
+
+// ELEMENT ACCESS
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::reference ring_buffer<T, A>::at(
+    size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("ring_buffer: index out of range");
+  }
+  return *cell(head_ + pos);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::const_reference ring_buffer<T, A>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("ring_buffer: index out of range");
+  }
+  return *cell(head_ + pos);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::reference ring_buffer<T, A>::operator[](
+    size_type pos) {
+  return *cell(head_ + pos);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::const_reference
+ring_buffer<T, A>::operator[](size_type pos) const {
+  return *cell(head_ + pos);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::reference ring_buffer<T, A>::front(void) {
+  return *cell(head_);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::const_reference ring_buffer<T, A>::front(
+    void) const {
+  return *cell(head_);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::reference ring_buffer<T, A>::back(void) {
+  return *cell(tail_ - 1);
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::const_reference ring_buffer<T, A>::back(
+    void) const {
+  return *cell(tail_ - 1);
+}
+
+// CAPACITY
+
+template <typename T, typename A>
+inline bool ring_buffer<T, A>::empty(void) const noexcept {
+  return head_ == tail_;
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::size_type ring_buffer<T, A>::size(
+    void) const noexcept {
+  return tail_ - head_;
+}
+
+/*
+ *  The largest power of two the allocator can provide.
+ */
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::size_type ring_buffer<T, A>::max_size(
+    void) const noexcept {
+  size_type limit = AllocTraits::max_size(allocator_);
+  size_type result = 1;
+  while (result <= limit / 2) {
+    result *= 2;
+  }
+  return result;
+}
+
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::size_type ring_buffer<T, A>::capacity(
+    void) const noexcept {
+  return capacity_;
+}
+
+/*
+ *  Make room for n elements. The capacity is rounded up to a power of two.
+ */
+template <typename T, typename A>
+void ring_buffer<T, A>::reserve(size_type n) {
+  if (n > capacity_) {
+    if (n > max_size()) {
+      throw std::length_error("ring_buffer: reserve exceeds max_size()");
+    }
+    size_type new_capacity = kMinCapacity;
+    while (new_capacity < n) {
+      new_capacity *= 2;
+    }
+    relocate(new_capacity);
+  }
+}
+
+// MODIFIERS
+
+template <typename T, typename A>
+void ring_buffer<T, A>::clear(void) noexcept {
+  if constexpr (!kTriviallyDestructible) {
+    for (size_type i = head_; i != tail_; ++i) {
+      AllocTraits::destroy(allocator_, cell(i));
+    }
+  }
+  head_ = 0;
+  tail_ = 0;
+}
+
+template <typename T, typename A>
+inline void ring_buffer<T, A>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename A>
+inline void ring_buffer<T, A>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/*
+ *  Construct an element in place at the end.
+ *  The buffer is left unchanged if an exception is thrown.
+ */
+template <typename T, typename A>
+template <typename... Args>
+typename ring_buffer<T, A>::reference ring_buffer<T, A>::emplace_back(
+    Args &&...args) {
+  if (tail_ - head_ == capacity_) {
+    // args may refer to an element of the buffer
+    value_type tmp(std::forward<Args>(args)...);
+    grow(1);
+    AllocTraits::construct(allocator_, cell(tail_), std::move(tmp));
+  } else {
+    AllocTraits::construct(allocator_, cell(tail_),
+                           std::forward<Args>(args)...);
+  }
+  return *cell(tail_++);
+}
+
+template <typename T, typename A>
+inline void ring_buffer<T, A>::pop_front(void) {
+  AllocTraits::destroy(allocator_, cell(head_));
+  ++head_;
+}
+
+/*
+ *  Append n values from the array with at most two span copies.
+ *  The array must not be a part of the buffer.
+ *  Nothing is appended if an exception is thrown.
+ */
+template <typename T, typename A>
+void ring_buffer<T, A>::push_n(const_pointer values, size_type n) {
+  if (capacity_ - size() < n) {
+    grow(n);
+  }
+  size_type offset = tail_ & (capacity_ - 1);
+  size_type first = std::min(n, capacity_ - offset);
+  if constexpr (kBitwiseCopyable) {
+    TrivialCopy(values, first, data_ + offset);
+    TrivialCopy(values + first, n - first, data_);
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        AllocTraits::construct(allocator_, cell(tail_ + i), values[i]);
+      }
+    } catch (...) {
+      while (i != 0) {
+        AllocTraits::destroy(allocator_, cell(tail_ + --i));
+      }
+      throw;
+    }
+  }
+  tail_ += n;
+}
+
+/*
+ *  Move up to n front values to the array of constructed values
+ *  and remove them. Returns the number of values removed.
+ */
+template <typename T, typename A>
+typename ring_buffer<T, A>::size_type ring_buffer<T, A>::pop_n(
+    pointer out, size_type n) {
+  n = std::min(n, size());
+  if (n == 0) {
+    return 0;
+  }
+  size_type offset = head_ & (capacity_ - 1);
+  size_type first = std::min(n, capacity_ - offset);
+  if constexpr (kBitwiseCopyable) {
+    TrivialCopy(data_ + offset, first, out);
+    TrivialCopy(data_, n - first, out + first);
+    head_ += n;
+  } else {
+    for (size_type i = 0; i < n; ++i) {
+      out[i] = std::move(front());
+      pop_front();
+    }
+  }
+  return n;
+}
+
+template <typename T, typename A>
+void ring_buffer<T, A>::swap(ring_buffer &other) noexcept {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
+  swap_data(other);
+}
+
+// Support functions
+
+/*
+ *  Cell of the position counted by head_ and tail_.
+ */
+template <typename T, typename A>
+inline typename ring_buffer<T, A>::pointer ring_buffer<T, A>::cell(
+    size_type position) const noexcept {
+  return data_ + (position & (capacity_ - 1));
+}
+
+/*
+ *  Make room for n more elements, at least doubling the capacity.
+ */
+template <typename T, typename A>
+void ring_buffer<T, A>::grow(size_type n) {
+  if (max_size() - size() < n) {
+    throw std::length_error("ring_buffer: insert exceeds max_size()");
+  }
+  reserve(std::max(size() + n, capacity_ * 2));
+}
+
+/*
+ *  Move the elements to the start of a new array of new_capacity cells.
+ *  Values are moved when the move constructor can't throw, otherwise they
+ *  are copied, so the buffer stays intact if an exception is thrown.
+ */
+template <typename T, typename A>
+void ring_buffer<T, A>::relocate(size_type new_capacity) {
+  pointer new_data = AllocTraits::allocate(allocator_, new_capacity);
+  size_type count = size();
+  if constexpr (kBitwiseCopyable) {
+    if (count != 0) {
+      size_type offset = head_ & (capacity_ - 1);
+      size_type first = std::min(count, capacity_ - offset);
+      TrivialCopy(data_ + offset, first, new_data);
+      TrivialCopy(data_, count - first, new_data + first);
+    }
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < count; ++i) {
+        AllocTraits::construct(allocator_, new_data + i,
+                               std::move_if_noexcept(*cell(head_ + i)));
+      }
+    } catch (...) {
+      while (i != 0) {
+        AllocTraits::destroy(allocator_, new_data + --i);
+      }
+      AllocTraits::deallocate(allocator_, new_data, new_capacity);
+      throw;
+    }
+  }
+  release();
+  data_ = new_data;
+  capacity_ = new_capacity;
+  head_ = 0;
+  tail_ = count;
+}
+
+/*
+ *  Destroy the elements and deallocate the array.
+ */
+template <typename T, typename A>
+void ring_buffer<T, A>::release(void) noexcept {
+  clear();
+  if (data_ != nullptr) {
+    AllocTraits::deallocate(allocator_, data_, capacity_);
+  }
+  data_ = nullptr;
+  capacity_ = 0;
+}
+
+/*
+ *  Exchange the storage, but not the allocators.
+ */
+template <typename T, typename A>
+inline void ring_buffer<T, A>::swap_data(ring_buffer &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_RING_BUFFER_H_
@@ -124,6 +124,16 @@ class set final {
   BinaryTree tree_;
 };
 
+/*
+ *  Erase the elements that satisfy the predicate in one sweep.
+ */
+template <typename Key, typename Compare, typename Allocator,
+          typename Predicate>
+typename set<Key, Compare, Allocator>::size_type erase_if(
+    set<Key, Compare, Allocator>& container, Predicate pred) {
+  return TreeEraseIf(container, pred);
+}
+
 }  // namespace s21
 
 #endif  // INCLUDE_S21_SET_H_
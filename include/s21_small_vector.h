@@ -0,0 +1,909 @@
+#ifndef INCLUDE_S21_SMALL_VECTOR_H_
+#define INCLUDE_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  A vector that keeps the first N elements in a buffer inside the object
+ *  and allocates from the heap only when it grows past N. The interface
+ *  is the one of s21::vector. Moving or swapping an inline small_vector
+ *  moves the elements, so iterators are invalidated.
+ */
+template <typename T, size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+
+  static_assert(N > 0, "small_vector: inline capacity must be positive");
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "small_vector: allocator value_type must be T");
+  static_assert(std::is_same<typename AllocTraits::pointer, T *>::value,
+                "small_vector: allocator must use raw pointers");
+
+  small_vector(void);
+  explicit small_vector(const allocator_type &alloc);
+  small_vector(size_type n, const allocator_type &alloc = allocator_type());
+  small_vector(const small_vector &other);
+  small_vector(const small_vector &other, const allocator_type &alloc);
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  small_vector(small_vector &&other, const allocator_type &alloc);
+  small_vector(std::initializer_list<value_type> const &items,
+               const allocator_type &alloc = allocator_type());
+  ~small_vector(void);
+  small_vector &operator=(const small_vector &other);
+  small_vector &operator=(small_vector &&other);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front(void);
+  const_reference front(void) const;
+  reference back(void);
+  const_reference back(void) const;
+  pointer data(void) noexcept;
+  const_pointer data(void) const noexcept;
+
+  iterator begin(void) noexcept;
+  const_iterator begin(void) const noexcept;
+  iterator end(void) noexcept;
+  const_iterator end(void) const noexcept;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type max_size(void) const noexcept;
+  void reserve(size_type size);
+  size_type capacity(void) const noexcept;
+  void shrink_to_fit(void);
+  bool is_inline(void) const noexcept;
+
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  iterator insert(iterator pos, size_type count, const_reference value);
+  template <typename InputIterator,
+            typename = typename std::iterator_traits<
+                InputIterator>::iterator_category>
+  iterator insert(iterator pos, InputIterator first, InputIterator last);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args);
+  void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible<T>::value &&
+      std::is_nothrow_swappable<T>::value);
+
+  template <typename... Args>
+  iterator insert_many(iterator position, Args &&...args);
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  static constexpr bool kBitwiseCopyable = CopiesBitwise<Allocator, T>::value;
+  static constexpr bool kTriviallyDestructible =
+      DestroysTrivially<Allocator, T>::value;
+
+ private:
+  pointer inline_data(void) noexcept;
+  pointer allocate(size_type n);
+  void deallocate(pointer ptr, size_type n);
+  template <typename... Args>
+  void construct(pointer ptr, Args &&...args);
+  void destroy(pointer ptr);
+  void destroy(pointer start, pointer finish);
+  void relocate(size_type new_capacity);
+  template <typename... Args>
+  void realloc_insert(iterator position, Args &&...args);
+  template <typename Filler>
+  iterator insert_aux(iterator position, size_type count, Filler fill);
+  template <typename InputIterator>
+  iterator insert_range(iterator position, InputIterator first,
+                        InputIterator last, std::input_iterator_tag);
+  template <typename ForwardIterator>
+  iterator insert_range(iterator position, ForwardIterator first,
+                        ForwardIterator last, std::forward_iterator_tag);
+  size_type grow_capacity(size_type count) const;
+  void release(void) noexcept;
+  void steal(small_vector &other) noexcept;
+  void move_elements(small_vector &other);
+
+ private:
+  allocator_type allocator_;
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+// Ctors, Dtor, overloaded operator=
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(void)
+    : allocator_(), data_(inline_data()), size_(0), capacity_(N) {}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(const allocator_type &alloc)
+    : allocator_(alloc), data_(inline_data()), size_(0), capacity_(N) {}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(size_type n, const allocator_type &alloc)
+    : small_vector(alloc) {
+  reserve(n);
+  UninitializedValueConstructN(allocator_, data_, n);
+  size_ = n;
+}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(
+    std::initializer_list<value_type> const &items,
+    const allocator_type &alloc)
+    : small_vector(alloc) {
+  reserve(items.size());
+  UninitializedCopy(allocator_, items.begin(), items.end(), data_);
+  size_ = items.size();
+}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(const small_vector &other)
+    : small_vector(other, AllocTraits::select_on_container_copy_construction(
+                              other.allocator_)) {}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(const small_vector &other,
+                                    const allocator_type &alloc)
+    : small_vector(alloc) {
+  reserve(other.size_);
+  UninitializedCopy(allocator_, other.begin(), other.end(), data_);
+  size_ = other.size_;
+}
+
+/*
+ *  The heap array of the other vector is taken over,
+ *  inline elements are moved one by one.
+ */
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(small_vector &&other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : small_vector(other.allocator_) {
+  if (other.is_inline()) {
+    move_elements(other);
+  } else {
+    steal(other);
+  }
+}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::small_vector(small_vector &&other,
+                                    const allocator_type &alloc)
+    : small_vector(alloc) {
+  if (!other.is_inline() && (AllocTraits::is_always_equal::value ||
+                             allocator_ == other.allocator_)) {
+    steal(other);
+  } else {
+    move_elements(other);
+  }
+}
+
+template <typename T, size_t N, typename A>
+small_vector<T, N, A>::~small_vector(void) {
+  release();
+}
+
+/*
+ *  Copy assignment. The allocator of the other vector is taken
+ *  if it propagates on copy assignment.
+ */
+template <typename T, size_t N, typename A>
+small_vector<T, N, A> &small_vector<T, N, A>::operator=(
+    const small_vector &other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+    if (!AllocTraits::is_always_equal::value &&
+        allocator_ != other.allocator_) {
+      release();
+    }
+    allocator_ = other.allocator_;
+  }
+
+  if (other.size_ > capacity_) {
+    pointer new_data = allocate(other.size_);
+    try {
+      UninitializedCopy(allocator_, other.begin(), other.end(), new_data);
+    } catch (...) {
+      deallocate(new_data, other.size_);
+      throw;
+    }
+    release();
+    data_ = new_data;
+    capacity_ = other.size_;
+  } else if (other.size_ <= size_) {
+    std::copy(other.begin(), other.end(), data_);
+    destroy(data_ + other.size_, data_ + size_);
+  } else {
+    std::copy(other.data_, other.data_ + size_, data_);
+    UninitializedCopy(allocator_, other.data_ + size_,
+                      other.data_ + other.size_, data_ + size_);
+  }
+  size_ = other.size_;
+
+  return *this;
+}
+
+/*
+ *  Move assignment. The heap array of the other vector is taken over
+ *  if the allocator propagates or the allocators are equal, otherwise
+ *  the elements are moved one by one.
+ */
+template <typename T, size_t N, typename A>
+small_vector<T, N, A> &small_vector<T, N, A>::operator=(
+    small_vector &&other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  constexpr bool kPropagate =
+      AllocTraits::propagate_on_container_move_assignment::value;
+  if (!other.is_inline() &&
+      (kPropagate || AllocTraits::is_always_equal::value ||
+       allocator_ == other.allocator_)) {
+    release();
+    if constexpr (kPropagate) {
+      allocator_ = other.allocator_;
+    }
+    steal(other);
+  } else {
+    if constexpr (kPropagate) {
+      release();
+      allocator_ = other.allocator_;
+    }
+    clear();
+    insert(end(), std::make_move_iterator(other.begin()),
+           std::make_move_iterator(other.end()));
+    other.clear();
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::allocator_type
+small_vector<T, N, A>::get_allocator(void) const noexcept {
+  return allocator_;
+}
+
+// Element access
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::reference small_vector<T, N, A>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("small_vector: at out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_reference
+small_vector<T, N, A>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("small_vector: at out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::reference
+small_vector<T, N, A>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_reference
+small_vector<T, N, A>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::reference small_vector<T, N, A>::front(
+    void) {
+  return data_[0];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_reference
+small_vector<T, N, A>::front(void) const {
+  return data_[0];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::reference small_vector<T, N, A>::back(
+    void) {
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_reference
+small_vector<T, N, A>::back(void) const {
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::pointer small_vector<T, N, A>::data(
+    void) noexcept {
+  return data_;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_pointer
+small_vector<T, N, A>::data(void) const noexcept {
+  return data_;
+}
+
+// ITERATORS
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::begin(
+    void) noexcept {
+  return data_;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_iterator
+small_vector<T, N, A>::begin(void) const noexcept {
+  return data_;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::end(
+    void) noexcept {
+  return data_ + size_;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::const_iterator
+small_vector<T, N, A>::end(void) const noexcept {
+  return data_ + size_;
+}
+
+// CAPACITY
+
+template <typename T, size_t N, typename A>
+inline bool small_vector<T, N, A>::empty(void) const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::size_type
+small_vector<T, N, A>::size(void) const noexcept {
+  return size_;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::size_type
+small_vector<T, N, A>::max_size(void) const noexcept {
+  return AllocTraits::max_size(allocator_);
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::reserve(size_type new_cap) {
+  if (new_cap > capacity_) {
+    relocate(new_cap);
+  }
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::size_type
+small_vector<T, N, A>::capacity(void) const noexcept {
+  return capacity_;
+}
+
+/*
+ *  Return a heap array to the allocator. The elements go back
+ *  to the inline buffer if they fit into it.
+ */
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::shrink_to_fit(void) {
+  if (capacity_ > size_ && !is_inline()) {
+    relocate(size_);
+  }
+}
+
+/*
+ *  True if the elements are kept in the inline buffer.
+ */
+template <typename T, size_t N, typename A>
+inline bool small_vector<T, N, A>::is_inline(void) const noexcept {
+  return data_ == reinterpret_cast<const_pointer>(storage_);
+}
+
+// MODIFIERS
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::clear() {
+  destroy(data_, data_ + size_);
+  size_ = 0;
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert(
+    iterator position, const_reference value) {
+  return emplace(position, value);
+}
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert(
+    iterator position, value_type &&value) {
+  return emplace(position, std::move(value));
+}
+
+/*
+ *  Insert count copies of the value before the position.
+ */
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert(
+    iterator position, size_type count, const_reference value) {
+  if (count == 0) {
+    return position;
+  }
+  value_type tmp(value);  // value may refer to an element of the vector
+  return insert_aux(position, count, [this, count, &tmp](pointer ptr) {
+    UninitializedFillN(allocator_, ptr, count, tmp);
+  });
+}
+
+/*
+ *  Insert copies of the elements from the range [first, last)
+ *  before the position.
+ */
+template <typename T, size_t N, typename A>
+template <typename InputIterator, typename>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert(
+    iterator position, InputIterator first, InputIterator last) {
+  return insert_range(
+      position, first, last,
+      typename std::iterator_traits<InputIterator>::iterator_category());
+}
+
+/*
+ *  Construct an element in place before the position.
+ */
+template <typename T, size_t N, typename A>
+template <typename... Args>
+inline typename small_vector<T, N, A>::iterator small_vector<T, N, A>::emplace(
+    iterator position, Args &&...args) {
+  size_type diff = position - data_;
+  if (size_ != capacity_ && position == end()) {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else if (size_ < capacity_) {
+    // args may refer to an element of the vector
+    value_type tmp(std::forward<Args>(args)...);
+    construct(data_ + size_, std::move(data_[size_ - 1]));
+    ++size_;
+    std::move_backward(position, data_ + size_ - 2, data_ + size_ - 1);
+    *position = std::move(tmp);
+  } else {
+    realloc_insert(position, std::forward<Args>(args)...);
+  }
+
+  return data_ + diff;
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::erase(iterator pos) {
+  if constexpr (kBitwiseCopyable) {
+    TrivialMove(pos + 1, data_ + size_ - pos - 1, pos);
+  } else if (pos != end()) {
+    std::move(pos + 1, data_ + size_, pos);
+  }
+  --size_;
+  destroy(data_ + size_);
+}
+
+/*
+ *  Erase the elements [first, last), shifting the tail once.
+ */
+template <typename T, size_t N, typename A>
+typename small_vector<T, N, A>::iterator small_vector<T, N, A>::erase(
+    iterator first, iterator last) {
+  if (first != last) {
+    pointer new_end;
+    if constexpr (kBitwiseCopyable) {
+      new_end = TrivialMove(last, data_ + size_ - last, first);
+    } else {
+      new_end = std::move(last, data_ + size_, first);
+    }
+    destroy(new_end, data_ + size_);
+    size_ = new_end - data_;
+  }
+  return first;
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/*
+ *  Construct an element in place at the end.
+ */
+template <typename T, size_t N, typename A>
+template <typename... Args>
+inline typename small_vector<T, N, A>::reference
+small_vector<T, N, A>::emplace_back(Args &&...args) {
+  if (size_ != capacity_) {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    realloc_insert(end(), std::forward<Args>(args)...);
+  }
+
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::pop_back() {
+  --size_;
+  destroy(data_ + size_);
+}
+
+/*
+ *  Resize to count elements, value-initializing the new ones. The
+ *  elements stay inline while count fits into the buffer.
+ */
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::resize(size_type count) {
+  if (count <= size_) {
+    destroy(data_ + count, data_ + size_);
+    size_ = count;
+  } else {
+    size_type n = count - size_;
+    insert_aux(end(), n, [this, n](pointer ptr) {
+      UninitializedValueConstructN(allocator_, ptr, n);
+    });
+  }
+}
+
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::resize(size_type count, const_reference value) {
+  if (count <= size_) {
+    destroy(data_ + count, data_ + size_);
+    size_ = count;
+  } else {
+    insert(end(), count - size_, value);
+  }
+}
+
+/*
+ *  Two heap arrays are exchanged by pointers. Inline elements are swapped
+ *  one by one, and the extra elements of the longer vector are moved
+ *  to the shorter one.
+ */
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::swap(small_vector &other) noexcept(
+    std::is_nothrow_move_constructible<T>::value &&
+    std::is_nothrow_swappable<T>::value) {
+  if (this == &other) {
+    return;
+  }
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
+
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  } else if (!is_inline() || !other.is_inline()) {
+    small_vector &heap = is_inline() ? other : *this;
+    small_vector &small = is_inline() ? *this : other;
+    pointer heap_data = heap.data_;
+    size_type heap_size = heap.size_;
+    size_type heap_capacity = heap.capacity_;
+    heap.data_ = heap.inline_data();
+    heap.size_ = 0;
+    heap.capacity_ = N;
+    heap.move_elements(small);
+    small.data_ = heap_data;
+    small.size_ = heap_size;
+    small.capacity_ = heap_capacity;
+  } else {
+    small_vector &shorter = size_ < other.size_ ? *this : other;
+    small_vector &longer = size_ < other.size_ ? other : *this;
+    std::swap_ranges(shorter.data_, shorter.data_ + shorter.size_,
+                     longer.data_);
+    UninitializedMove(allocator_, longer.data_ + shorter.size_,
+                      longer.data_ + longer.size_,
+                      shorter.data_ + shorter.size_);
+    destroy(longer.data_ + shorter.size_, longer.data_ + longer.size_);
+    std::swap(size_, other.size_);
+  }
+}
+
+// INSERT MANY
+
+/*
+ *  Construct the arguments in place before the position with a single
+ *  shift of the tail. The arguments must not refer to elements of the vector
+ *  at or after the position.
+ */
+template <typename T, size_t N, typename A>
+template <typename... Args>
+typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert_many(
+    iterator pos, Args &&...args) {
+  iterator first = insert_aux(pos, sizeof...(Args), [&](pointer ptr) {
+    pointer start = ptr;
+    try {
+      ((construct(ptr, std::forward<Args>(args)), ++ptr), ...);
+    } catch (...) {
+      destroy(start, ptr);
+      throw;
+    }
+  });
+
+  return first + sizeof...(Args);
+}
+
+template <typename T, size_t N, typename A>
+template <typename... Args>
+void small_vector<T, N, A>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+// Auxiliary private methods
+
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::pointer
+small_vector<T, N, A>::inline_data(void) noexcept {
+  return reinterpret_cast<pointer>(storage_);
+}
+
+/*
+ *  Allocate uninitialized memory for n cells from the heap.
+ */
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::pointer
+small_vector<T, N, A>::allocate(size_type n) {
+  if (n > max_size()) {
+    throw std::length_error(
+        "cannot create small_vector larger then max_size()");
+  }
+  return AllocTraits::allocate(allocator_, n);
+}
+
+/*
+ *  Deallocate array of n cells. The inline buffer is never deallocated.
+ */
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::deallocate(pointer ptr, size_type n) {
+  if (ptr != inline_data()) {
+    AllocTraits::deallocate(allocator_, ptr, n);
+  }
+}
+
+template <typename T, size_t N, typename A>
+template <typename... Args>
+inline void small_vector<T, N, A>::construct(pointer ptr, Args &&...args) {
+  AllocTraits::construct(allocator_, ptr, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::destroy(pointer start, pointer finish) {
+  DestroyRange(allocator_, start, finish);
+}
+
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::destroy(pointer ptr) {
+  if constexpr (!kTriviallyDestructible) {
+    AllocTraits::destroy(allocator_, ptr);
+  }
+}
+
+/*
+ *  Destroy the elements, deallocate the heap array
+ *  and go back to the inline buffer.
+ */
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::release(void) noexcept {
+  destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
+  data_ = inline_data();
+  size_ = 0;
+  capacity_ = N;
+}
+
+/*
+ *  Take over the heap array of the other vector. This vector must be
+ *  empty and inline, the other one becomes empty and inline.
+ */
+template <typename T, size_t N, typename A>
+inline void small_vector<T, N, A>::steal(small_vector &other) noexcept {
+  data_ = other.data_;
+  size_ = other.size_;
+  capacity_ = other.capacity_;
+  other.data_ = other.inline_data();
+  other.size_ = 0;
+  other.capacity_ = N;
+}
+
+/*
+ *  Move the elements of the other vector into this empty vector
+ *  and destroy them in the other one.
+ */
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::move_elements(small_vector &other) {
+  reserve(other.size_);
+  UninitializedMove(allocator_, other.data_, other.data_ + other.size_, data_);
+  size_ = other.size_;
+  other.clear();
+}
+
+/*
+ *  Move the elements to a heap array of new_capacity cells, or to the
+ *  inline buffer if new_capacity fits into it and the elements are on
+ *  the heap. The vector is left unchanged if an exception is thrown.
+ */
+template <typename T, size_t N, typename A>
+void small_vector<T, N, A>::relocate(size_type new_capacity) {
+  bool to_inline = new_capacity <= N;
+  if (to_inline) {
+    new_capacity = N;
+  }
+  pointer new_data = to_inline ? inline_data() : allocate(new_capacity);
+  try {
+    UninitializedMoveIfNoexcept(allocator_, data_, data_ + size_, new_data);
+  } catch (...) {
+    deallocate(new_data, new_capacity);
+    throw;
+  }
+  destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+/*
+ *  Emplace into a full vector, which always moves it to the heap.
+ */
+template <typename T, size_t N, typename A>
+template <typename... Args>
+void small_vector<T, N, A>::realloc_insert(iterator position,
+                                           Args &&...args) {
+  insert_aux(position, 1, [&](pointer ptr) {
+    construct(ptr, std::forward<Args>(args)...);
+  });
+}
+
+/*
+ *  Insert count elements built by fill(ptr) before the position, in place
+ *  with FillGap or into a larger heap array with FillAround. Returns the
+ *  iterator to the first inserted element.
+ */
+template <typename T, size_t N, typename A>
+template <typename Filler>
+typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert_aux(
+    iterator position, size_type count, Filler fill) {
+  size_type diff = position - data_;
+  if (count == 0) {
+    return position;
+  }
+
+  if (capacity_ - size_ >= count) {
+    FillGap(allocator_, position, end(), count, fill);
+    size_ += count;
+  } else {
+    size_type new_capacity = grow_capacity(count);
+    pointer new_data = allocate(new_capacity);
+    try {
+      FillAround(allocator_, data_, position, end(), new_data, count, fill);
+    } catch (...) {
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    destroy(data_, data_ + size_);
+    deallocate(data_, capacity_);
+    data_ = new_data;
+    size_ += count;
+    capacity_ = new_capacity;
+  }
+
+  return data_ + diff;
+}
+
+/*
+ *  Insert elements of a single pass range one by one at the end
+ *  and rotate them into place.
+ */
+template <typename T, size_t N, typename A>
+template <typename InputIterator>
+typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert_range(
+    iterator position, InputIterator first, InputIterator last,
+    std::input_iterator_tag) {
+  size_type diff = position - data_;
+  size_type old_size = size_;
+  try {
+    while (first != last) {
+      emplace_back(*first);
+      ++first;
+    }
+  } catch (...) {
+    destroy(data_ + old_size, data_ + size_);
+    size_ = old_size;
+    throw;
+  }
+  std::rotate(data_ + diff, data_ + old_size, data_ + size_);
+
+  return data_ + diff;
+}
+
+/*
+ *  Insert elements of a multi pass range with a single shift of the tail.
+ */
+template <typename T, size_t N, typename A>
+template <typename ForwardIterator>
+typename small_vector<T, N, A>::iterator small_vector<T, N, A>::insert_range(
+    iterator position, ForwardIterator first, ForwardIterator last,
+    std::forward_iterator_tag) {
+  size_type count = std::distance(first, last);
+  return insert_aux(position, count, [this, first, last](pointer ptr) {
+    UninitializedCopy(allocator_, first, last, ptr);
+  });
+}
+
+/*
+ *  Capacity for inserting count elements into the full vector.
+ */
+template <typename T, size_t N, typename A>
+inline typename small_vector<T, N, A>::size_type
+small_vector<T, N, A>::grow_capacity(size_type count) const {
+  if (max_size() - size_ < count) {
+    throw std::length_error("small_vector: insert exceeds max_size()");
+  }
+  size_type new_capacity = size_ + std::max(size_, count);
+  return new_capacity < size_ || new_capacity > max_size() ? max_size()
+                                                           : new_capacity;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_SMALL_VECTOR_H_
@@ -0,0 +1,357 @@
+#ifndef INCLUDE_S21_SPSC_QUEUE_H_
+#define INCLUDE_S21_SPSC_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Bounded FIFO queue for exactly one producer thread and one consumer
+ *  thread. Every operation is wait-free: it finishes in a bounded number
+ *  of steps whatever the other thread does, and reports a full or empty
+ *  queue instead of blocking.
+ *
+ *  The capacity is fixed and rounded up to a power of two. head_ and
+ *  tail_ count the popped and pushed elements and live on separate cache
+ *  lines. Each side keeps a private copy of the other side's counter and
+ *  reloads it only when the copy says the queue is full or empty, so in
+ *  a steady stream the threads rarely touch each other's line.
+ *
+ *  The try_push family may be called only by the producer, the try_pop
+ *  family, front and pop only by the consumer.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "spsc_queue: allocator value_type must be T");
+  static_assert(std::is_same<typename AllocTraits::pointer, T *>::value,
+                "spsc_queue: allocator must use raw pointers");
+
+  explicit spsc_queue(size_type capacity,
+                      const allocator_type &alloc = allocator_type());
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue(void);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type capacity(void) const noexcept;
+
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  size_type try_push_n(const_pointer values, size_type n);
+
+  bool try_pop(reference out);
+  size_type try_pop_n(pointer out, size_type n);
+  pointer front(void) noexcept;
+  void pop(void) noexcept;
+
+ private:
+  // Bulk kernels bypass the allocator's construct and destroy,
+  // so they are used only when the allocator doesn't customize them.
+  static constexpr bool kBitwiseCopyable =
+      std::is_trivially_copyable<T>::value &&
+      UsesDefaultConstruct<Allocator, T>::value;
+  static constexpr bool kTriviallyDestructible =
+      std::is_trivially_destructible<T>::value &&
+      UsesDefaultConstruct<Allocator, T>::value;
+
+  static size_type round_capacity(size_type n);
+  pointer cell(size_type position) const noexcept;
+  size_type free_cells(size_type tail, size_type wanted) noexcept;
+  size_type ready_cells(size_type head, size_type wanted) noexcept;
+
+ private:
+  // Shared and never written after construction.
+  allocator_type allocator_;
+  pointer data_;
+  size_type mask_;
+
+  // Written by the producer.
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  size_type cached_head_;
+
+  // Written by the consumer.
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+  size_type cached_tail_;
+};
+
+// Ctors, Dtor
+
+template <typename T, typename A>
+spsc_queue<T, A>::spsc_queue(size_type capacity, const allocator_type &alloc)
+    : allocator_(alloc),
+      data_(nullptr),
+      mask_(round_capacity(capacity) - 1),
+      tail_(0),
+      cached_head_(0),
+      head_(0),
+      cached_tail_(0) {
+  data_ = AllocTraits::allocate(allocator_, mask_ + 1);
+}
+
+template <typename T, typename A>
+spsc_queue<T, A>::~spsc_queue(void) {
+  if constexpr (!kTriviallyDestructible) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      AllocTraits::destroy(allocator_, cell(i));
+    }
+  }
+  AllocTraits::deallocate(allocator_, data_, mask_ + 1);
+}
+
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::allocator_type
+spsc_queue<T, A>::get_allocator(void) const noexcept {
+  return allocator_;
+}
+
+// CAPACITY
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline bool spsc_queue<T, A>::empty(void) const noexcept {
+  return size() == 0;
+}
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::size_type spsc_queue<T, A>::size(
+    void) const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  // the consumer may pop and the producer refill between the two loads
+  return std::min(tail - head, capacity());
+}
+
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::size_type spsc_queue<T, A>::capacity(
+    void) const noexcept {
+  return mask_ + 1;
+}
+
+// PRODUCER
+
+template <typename T, typename A>
+inline bool spsc_queue<T, A>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T, typename A>
+inline bool spsc_queue<T, A>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+/*
+ *  Construct an element in place at the end. Returns false and leaves
+ *  args untouched if the queue is full. Nothing is pushed if the
+ *  constructor throws.
+ */
+template <typename T, typename A>
+template <typename... Args>
+bool spsc_queue<T, A>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_cells(tail, 1) == 0) {
+    return false;
+  }
+  AllocTraits::construct(allocator_, cell(tail), std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+/*
+ *  Copy up to n values from the array to the end and publish them at
+ *  once. Returns the number of values pushed. Nothing is pushed if
+ *  a copy constructor throws.
+ */
+template <typename T, typename A>
+typename spsc_queue<T, A>::size_type spsc_queue<T, A>::try_push_n(
+    const_pointer values, size_type n) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  n = std::min(n, free_cells(tail, n));
+  if (n == 0) {
+    return 0;
+  }
+  if constexpr (kBitwiseCopyable) {
+    size_type offset = tail & mask_;
+    size_type first = std::min(n, mask_ + 1 - offset);
+    TrivialCopy(values, first, data_ + offset);
+    TrivialCopy(values + first, n - first, data_);
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        AllocTraits::construct(allocator_, cell(tail + i), values[i]);
+      }
+    } catch (...) {
+      while (i != 0) {
+        AllocTraits::destroy(allocator_, cell(tail + --i));
+      }
+      throw;
+    }
+  }
+  tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+// CONSUMER
+
+/*
+ *  Move the front element to out and remove it.
+ *  Returns false if the queue is empty.
+ */
+template <typename T, typename A>
+bool spsc_queue<T, A>::try_pop(reference out) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ready_cells(head, 1) == 0) {
+    return false;
+  }
+  out = std::move(*cell(head));
+  AllocTraits::destroy(allocator_, cell(head));
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+/*
+ *  Move up to n front values to the array of constructed values and
+ *  release their cells at once. Returns the number of values removed.
+ *  If a move assignment throws, the values moved before it stay popped.
+ */
+template <typename T, typename A>
+typename spsc_queue<T, A>::size_type spsc_queue<T, A>::try_pop_n(
+    pointer out, size_type n) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  n = std::min(n, ready_cells(head, n));
+  if (n == 0) {
+    return 0;
+  }
+  if constexpr (kBitwiseCopyable) {
+    size_type offset = head & mask_;
+    size_type first = std::min(n, mask_ + 1 - offset);
+    TrivialCopy(data_ + offset, first, out);
+    TrivialCopy(data_, n - first, out + first);
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        out[i] = std::move(*cell(head + i));
+        AllocTraits::destroy(allocator_, cell(head + i));
+      }
+    } catch (...) {
+      head_.store(head + i, std::memory_order_release);
+      throw;
+    }
+  }
+  head_.store(head + n, std::memory_order_release);
+  return n;
+}
+
+/*
+ *  The front element, or nullptr if the queue is empty. The element
+ *  stays valid until pop(), so it may be consumed in place.
+ */
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::pointer spsc_queue<T, A>::front(
+    void) noexcept {
+  size_type head = head_.load(std::memory_order_relaxed);
+  return ready_cells(head, 1) == 0 ? nullptr : cell(head);
+}
+
+/*
+ *  Remove the front element. The queue must not be empty.
+ */
+template <typename T, typename A>
+inline void spsc_queue<T, A>::pop(void) noexcept {
+  size_type head = head_.load(std::memory_order_relaxed);
+  AllocTraits::destroy(allocator_, cell(head));
+  head_.store(head + 1, std::memory_order_release);
+}
+
+// Support functions
+
+/*
+ *  The smallest power of two that is not less than n and 1.
+ */
+template <typename T, typename A>
+typename spsc_queue<T, A>::size_type spsc_queue<T, A>::round_capacity(
+    size_type n) {
+  size_type limit = std::numeric_limits<size_type>::max() / 2 / sizeof(T);
+  if (n > limit) {
+    throw std::length_error("spsc_queue: capacity is too large");
+  }
+  size_type result = 1;
+  while (result < n) {
+    result *= 2;
+  }
+  return result;
+}
+
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::pointer spsc_queue<T, A>::cell(
+    size_type position) const noexcept {
+  return data_ + (position & mask_);
+}
+
+/*
+ *  Number of cells the producer may fill past tail. The consumer's head
+ *  is reloaded only when the cached copy shows fewer than wanted cells.
+ */
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::size_type spsc_queue<T, A>::free_cells(
+    size_type tail, size_type wanted) noexcept {
+  size_type free = mask_ + 1 - (tail - cached_head_);
+  if (free < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free = mask_ + 1 - (tail - cached_head_);
+  }
+  return free;
+}
+
+/*
+ *  Number of values the consumer may take from head. The producer's tail
+ *  is reloaded only when the cached copy shows fewer than wanted values.
+ */
+template <typename T, typename A>
+inline typename spsc_queue<T, A>::size_type spsc_queue<T, A>::ready_cells(
+    size_type head, size_type wanted) noexcept {
+  size_type ready = cached_tail_ - head;
+  if (ready < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    ready = cached_tail_ - head;
+  }
+  return ready;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_SPSC_QUEUE_H_
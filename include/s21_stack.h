@@ -7,18 +7,31 @@
 #include <initializer_list>
 #include <utility>
 
+#include "s21_deque.h"
+
 namespace s21 {
 
-template <typename T>
+/*
+ *  LIFO adaptor over a sequence container. The container must provide
+ *  back, push_back, emplace_back, pop_back, empty, size and swap, as
+ *  s21::deque, s21::vector and s21::list do.
+ */
+template <typename T, typename Container = deque<T>>
 class stack final {
  public:
-  using value_type = T;
-  using reference = value_type &;
-  using const_reference = const value_type &;
-  using size_type = size_t;
+  using container_type = Container;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
 
  public:
-  stack(void) : head_(nullptr) {}
+  stack(void) : container_() {}
+
+  explicit stack(const container_type &container) : container_(container) {}
+
+  explicit stack(container_type &&container)
+      : container_(std::move(container)) {}
 
   stack(std::initializer_list<value_type> const &items) : stack() {
     for (const value_type &item : items) {
@@ -26,16 +39,7 @@ class stack final {
     }
   }
 
-  stack(const stack &other) : stack() {
-    StackNode **node_ptr = &head_;
-    StackNode *node_other = other.head_;
-    while (node_other != nullptr) {
-      StackNode *tmp = new StackNode{nullptr, node_other->value};
-      *node_ptr = tmp;
-      node_ptr = &tmp->next;
-      node_other = node_other->next;
-    }
-  }
+  stack(const stack &other) : container_(other.container_) {}
 
   stack(stack &&other) : stack() { swap(other); }
 
@@ -55,73 +59,37 @@ class stack final {
     return *this;
   }
 
-  ~stack(void) {
-    while (head_ != nullptr) {
-      StackNode *tmp = head_;
-      head_ = head_->next;
-      delete tmp;
-    }
-  }
-
  public:
-  reference top(void) { return head_->value; }
-  const_reference top(void) const { return head_->value; }
+  reference top(void) { return container_.back(); }
+  const_reference top(void) const { return container_.back(); }
 
  public:
-  bool empty(void) const noexcept { return head_ == nullptr; }
-
-  size_type size(void) const noexcept {
-    size_type sz = 0;
-    StackNode *tmp = head_;
-    while (tmp != nullptr) {
-      ++sz;
-      tmp = tmp->next;
-    }
-    return sz;
-  }
+  bool empty(void) const noexcept { return container_.empty(); }
 
- public:
-  void push(const_reference value) {
-    StackNode *node = new StackNode{head_, value};
-    head_ = node;
-  }
+  size_type size(void) const noexcept { return container_.size(); }
 
-  void pop(void) {
-    StackNode *node = head_;
-    head_ = head_->next;
-    delete node;
-  }
+ public:
+  void push(const_reference value) { container_.push_back(value); }
 
-  void swap(stack &other) noexcept { std::swap(head_, other.head_); }
+  void push(value_type &&value) { container_.push_back(std::move(value)); }
 
- public:
   template <typename... Args>
-  void insert_many_front(Args &&...args) {
-    insert_many_front_aux(args...);
+  decltype(auto) emplace(Args &&...args) {
+    return container_.emplace_back(std::forward<Args>(args)...);
   }
 
- private:
-  void insert_many_front_aux(void) {}
+  void pop(void) { container_.pop_back(); }
 
-  template <typename U>
-  void insert_many_front_aux(U &&arg) {
-    push(arg);
-  }
+  void swap(stack &other) noexcept { container_.swap(other.container_); }
 
-  template <typename U, typename... Args>
-  void insert_many_front_aux(U &&arg, Args &&...args) {
-    push(arg);
-    insert_many_front_aux(args...);
+ public:
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (emplace(std::forward<Args>(args)), ...);
   }
 
  private:
-  struct StackNode final {
-    StackNode *next;
-    T value;
-  };
-
- private:
-  StackNode *head_;
+  container_type container_;
 };
 
 }  // namespace s21
@@ -0,0 +1,396 @@
+#ifndef INCLUDE_S21_THREAD_POOL_H_
+#define INCLUDE_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_mpmc_queue.h"
+#include "s21_utils.h"
+#include "s21_vector.h"
+#include "s21_ws_deque.h"
+
+namespace s21 {
+
+/*
+ *  Fork-join thread pool with work stealing.
+ *
+ *  Every worker owns a ws_deque of tasks. A task spawned by a worker goes
+ *  to the bottom of its own deque and is usually run by the same worker,
+ *  newest first, while its cache is warm. An idle worker steals the
+ *  oldest task of another worker, which in a recursive split is the
+ *  largest piece of work left. Tasks spawned by other threads go through
+ *  a shared injection queue.
+ *
+ *  spawn runs a task some time later and wait returns when every spawned
+ *  task has finished. parallel_invoke runs its callables in parallel and
+ *  returns when all of them are done, and may be nested in the tasks it
+ *  runs: the spawned parts live in the caller's frame, so a nested fork
+ *  does not allocate, and a waiting thread runs other tasks instead of
+ *  blocking.
+ *
+ *  Idle workers spin, then yield, then sleep on a condition variable.
+ *  A spawn touches the lock only when some worker is asleep.
+ */
+class thread_pool final {
+ public:
+  using size_type = size_t;
+
+  static constexpr size_type kSpinCount = 64;
+  static constexpr size_type kYieldCount = 16;
+
+  explicit thread_pool(size_type threads = default_threads());
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool(void);
+
+  size_type size(void) const noexcept;
+  static size_type default_threads(void) noexcept;
+
+  template <typename F>
+  void spawn(F &&f);
+  void wait(void);
+  template <typename F>
+  void parallel_invoke(F &&f);
+  template <typename F, typename... Fs>
+  void parallel_invoke(F &&f, Fs &&...fs);
+
+ private:
+  class Task {
+   public:
+    virtual void execute(void) noexcept = 0;
+
+   protected:
+    ~Task(void) = default;
+  };
+
+  // A spawned task. It owns its callable and deletes itself when done.
+  template <typename F>
+  class HeapTask final : public Task {
+   public:
+    template <typename G>
+    HeapTask(thread_pool *pool, G &&f)
+        : pool_(pool), f_(std::forward<G>(f)) {}
+
+    void execute(void) noexcept override {
+      thread_pool *pool = pool_;
+      f_();
+      delete this;
+      pool->pending_.fetch_sub(1, std::memory_order_release);
+    }
+
+   private:
+    thread_pool *pool_;
+    F f_;
+  };
+
+  // A part of parallel_invoke, living in the frame of the caller, who
+  // waits until done_ is set and then rethrows what the callable threw.
+  template <typename F>
+  class FrameTask final : public Task {
+   public:
+    explicit FrameTask(F &f) noexcept : f_(f), done_(false) {}
+
+    void execute(void) noexcept override {
+      try {
+        f_();
+      } catch (...) {
+        error_ = std::current_exception();
+      }
+      done_.store(true, std::memory_order_release);
+    }
+
+    bool done(void) const noexcept {
+      return done_.load(std::memory_order_acquire);
+    }
+    void rethrow(void) const {
+      if (error_) {
+        std::rethrow_exception(error_);
+      }
+    }
+
+   private:
+    F &f_;
+    std::exception_ptr error_;
+    std::atomic<bool> done_;
+  };
+
+  struct alignas(kCacheLineSize) Worker {
+    ws_deque<Task *> tasks;
+  };
+
+  // The worker the calling thread is, if any.
+  struct Current {
+    thread_pool *pool = nullptr;
+    size_type index = 0;
+    size_type victim = 0;
+  };
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  static Current &current(void) noexcept;
+  size_type self(void) const noexcept;
+  void submit(Task *task);
+  void notify(void);
+  Task *find_task(size_type self) noexcept;
+  bool has_work(void) const noexcept;
+  template <typename Predicate>
+  void help_until(Predicate done);
+  void worker_loop(size_type index);
+  void stop(void) noexcept;
+
+ private:
+  size_type count_;
+  std::unique_ptr<Worker[]> workers_;
+  mpmc_queue<Task *> injected_;
+  std::atomic<size_type> pending_;
+  std::atomic<size_type> sleepers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_;
+  vector<std::thread> threads_;
+};
+
+// Ctors, Dtor
+
+inline thread_pool::thread_pool(size_type threads)
+    : count_(threads == 0 ? 1 : threads),
+      workers_(new Worker[count_]),
+      injected_(1024),
+      pending_(0),
+      sleepers_(0),
+      stopping_(false) {
+  try {
+    threads_.reserve(count_);
+    for (size_type i = 0; i < count_; ++i) {
+      threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+/*
+ *  Wait for the spawned tasks and stop the workers.
+ */
+inline thread_pool::~thread_pool(void) {
+  wait();
+  stop();
+}
+
+inline thread_pool::size_type thread_pool::size(void) const noexcept {
+  return count_;
+}
+
+inline thread_pool::size_type thread_pool::default_threads(void) noexcept {
+  size_type threads = std::thread::hardware_concurrency();
+  return threads == 0 ? 1 : threads;
+}
+
+// TASKS
+
+/*
+ *  Run f() on some thread of the pool. f must not throw.
+ */
+template <typename F>
+void thread_pool::spawn(F &&f) {
+  auto *task = new HeapTask<std::decay_t<F>>(this, std::forward<F>(f));
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    submit(task);
+  } catch (...) {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    delete task;
+    throw;
+  }
+}
+
+/*
+ *  Return when every spawned task has finished, running tasks meanwhile.
+ *  Must not be called from a task, which would wait for itself; nested
+ *  forks use parallel_invoke.
+ */
+inline void thread_pool::wait(void) {
+  help_until(
+      [this] { return pending_.load(std::memory_order_acquire) == 0; });
+}
+
+template <typename F>
+inline void thread_pool::parallel_invoke(F &&f) {
+  f();
+}
+
+/*
+ *  Run f and fs in parallel and return when all of them are done. f is
+ *  offered to other threads while this thread runs fs, then this thread
+ *  runs f itself unless it has been stolen. If any of them throws, the
+ *  rest still finish and the first exception in argument order is
+ *  rethrown.
+ */
+template <typename F, typename... Fs>
+void thread_pool::parallel_invoke(F &&f, Fs &&...fs) {
+  FrameTask<std::remove_reference_t<F>> task(f);
+  submit(&task);
+  try {
+    parallel_invoke(std::forward<Fs>(fs)...);
+  } catch (...) {
+    help_until([&task] { return task.done(); });
+    task.rethrow();
+    throw;
+  }
+  help_until([&task] { return task.done(); });
+  task.rethrow();
+}
+
+// Support functions
+
+inline thread_pool::Current &thread_pool::current(void) noexcept {
+  static thread_local Current current;
+  return current;
+}
+
+/*
+ *  The index of the calling worker, npos for other threads.
+ */
+inline thread_pool::size_type thread_pool::self(void) const noexcept {
+  const Current &me = current();
+  return me.pool == this ? me.index : npos;
+}
+
+inline void thread_pool::submit(Task *task) {
+  size_type index = self();
+  if (index != npos) {
+    workers_[index].tasks.push(task);
+  } else {
+    injected_.push(task);
+  }
+  notify();
+}
+
+/*
+ *  Wake a sleeping worker. The fence orders the push of the task before
+ *  the read of sleepers_, and a worker raises sleepers_ before it looks
+ *  for work, so either the worker sees the task or we see the worker.
+ */
+inline void thread_pool::notify(void) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleepers_.load(std::memory_order_relaxed) != 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_.notify_one();
+  }
+}
+
+/*
+ *  Take a task from the own deque, the injection queue or a victim, in
+ *  that order. Victims are tried round robin from a per-thread cursor.
+ */
+inline thread_pool::Task *thread_pool::find_task(size_type self) noexcept {
+  Task *task = nullptr;
+  if (self != npos && workers_[self].tasks.try_pop(task)) {
+    return task;
+  }
+  if (injected_.try_pop(task)) {
+    return task;
+  }
+  size_type &victim = current().victim;
+  for (size_type i = 0; i < count_; ++i) {
+    victim = victim + 1 < count_ ? victim + 1 : 0;
+    if (victim != self && workers_[victim].tasks.try_steal(task)) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+inline bool thread_pool::has_work(void) const noexcept {
+  if (!injected_.empty()) {
+    return true;
+  }
+  for (size_type i = 0; i < count_; ++i) {
+    if (!workers_[i].tasks.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ *  Run tasks until done() holds, spinning and yielding when there are
+ *  none. The awaited tasks may be running on other threads.
+ */
+template <typename Predicate>
+void thread_pool::help_until(Predicate done) {
+  size_type index = self();
+  size_type idle = 0;
+  while (!done()) {
+    Task *task = find_task(index);
+    if (task != nullptr) {
+      task->execute();
+      idle = 0;
+    } else if (++idle < kSpinCount) {
+      CpuRelax();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+inline void thread_pool::worker_loop(size_type index) {
+  Current &me = current();
+  me.pool = this;
+  me.index = index;
+  me.victim = index;
+  size_type idle = 0;
+  while (true) {
+    Task *task = find_task(index);
+    if (task != nullptr) {
+      task->execute();
+      idle = 0;
+      continue;
+    }
+    if (++idle < kSpinCount) {
+      CpuRelax();
+      continue;
+    }
+    if (idle < kSpinCount + kYieldCount) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleepers_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!stopping_ && !has_work()) {
+      wake_.wait(lock);
+    }
+    sleepers_.fetch_sub(1);
+    if (stopping_) {
+      return;
+    }
+    idle = 0;
+  }
+}
+
+/*
+ *  Wake every worker, let it exit and join it.
+ */
+inline void thread_pool::stop(void) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &thread : threads_) {
+    thread.join();
+  }
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_THREAD_POOL_H_
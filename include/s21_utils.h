@@ -3,6 +3,14 @@
 #ifndef INCLUDE_S21_UTILS_H_
 #define INCLUDE_S21_UTILS_H_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
 namespace s21 {
 
 // Auxiliary structs
@@ -49,6 +57,440 @@ struct Less : public BinaryFunction<T, T, bool> {
   bool operator()(const T& lhs, const T& rhs) const { return lhs < rhs; }
 };
 
+// Allocator traits
+
+template <typename Alloc, typename T, typename = void>
+struct HasConstruct : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasConstruct<Alloc, T,
+                    std::void_t<decltype(std::declval<Alloc&>().construct(
+                        std::declval<T*>(), std::declval<const T&>()))>>
+    : std::true_type {};
+
+template <typename Alloc, typename T, typename = void>
+struct HasDestroy : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasDestroy<Alloc, T,
+                  std::void_t<decltype(std::declval<Alloc&>().destroy(
+                      std::declval<T*>()))>> : std::true_type {};
+
+/*
+ *  True if the allocator constructs and destroys values of T
+ *  with plain placement new and destructor calls, so containers may
+ *  bypass it for trivial types.
+ */
+template <typename Alloc, typename T>
+struct UsesDefaultConstruct
+    : std::integral_constant<bool,
+                             std::is_same<Alloc, std::allocator<T>>::value ||
+                                 (!HasConstruct<Alloc, T>::value &&
+                                  !HasDestroy<Alloc, T>::value)> {};
+
+/*
+ *  True if the allocator can resize a block of T in place of
+ *  allocate, copy and deallocate: ptr = alloc.reallocate(ptr, old_n, new_n).
+ */
+template <typename Alloc, typename T, typename = void>
+struct HasReallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasReallocate<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc&>().reallocate(
+        std::declval<T*>(), std::declval<size_t>(), std::declval<size_t>()))>>
+    : std::true_type {};
+
+// Bulk kernels for trivially copyable types
+
+/*
+ *  True if values of the iterator can be copied bytewise into cells of T.
+ */
+template <typename Iterator, typename T>
+struct IsBitwiseCopyable
+    : std::integral_constant<
+          bool, std::is_trivially_copyable<T>::value &&
+                    std::is_pointer<Iterator>::value &&
+                    std::is_same<typename std::remove_cv<
+                                     typename std::iterator_traits<
+                                         Iterator>::value_type>::type,
+                                 T>::value> {};
+
+/*
+ *  Copy n trivially copyable values to non-overlapping cells.
+ */
+template <typename T>
+inline T* TrivialCopy(const T* first, size_t n, T* dest) noexcept {
+  if (n != 0) {
+    std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                n * sizeof(T));
+  }
+  return dest + n;
+}
+
+/*
+ *  Copy n trivially copyable values to cells that may overlap the source.
+ */
+template <typename T>
+inline T* TrivialMove(const T* first, size_t n, T* dest) noexcept {
+  if (n != 0) {
+    std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                 n * sizeof(T));
+  }
+  return dest + n;
+}
+
+/*
+ *  Fill n cells with a trivially copyable value.
+ *  Values whose bytes are all equal are stored with memset.
+ */
+template <typename T>
+inline T* TrivialFill(T* dest, size_t n, const T& value) noexcept {
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+  if (n != 0 && std::all_of(bytes, bytes + sizeof(T),
+                            [bytes](unsigned char b) { return b == *bytes; })) {
+    std::memset(static_cast<void*>(dest), *bytes, n * sizeof(T));
+  } else {
+    std::fill_n(dest, n, value);
+  }
+  return dest + n;
+}
+
+// Uninitialized ranges of vector-like containers
+
+/*
+ *  True if the allocator leaves values of T to bitwise copies, so bulk
+ *  kernels may bypass its construct.
+ */
+template <typename Alloc, typename T>
+struct CopiesBitwise
+    : std::integral_constant<bool,
+                             std::is_trivially_copyable<T>::value &&
+                                 UsesDefaultConstruct<Alloc, T>::value> {};
+
+/*
+ *  True if destroying values of T through the allocator does nothing.
+ */
+template <typename Alloc, typename T>
+struct DestroysTrivially
+    : std::integral_constant<bool,
+                             std::is_trivially_destructible<T>::value &&
+                                 UsesDefaultConstruct<Alloc, T>::value> {};
+
+/*
+ *  Destroy the values [first, last).
+ */
+template <typename Alloc, typename T>
+inline void DestroyRange(Alloc& alloc, T* first, T* last) noexcept {
+  if constexpr (!DestroysTrivially<Alloc, T>::value) {
+    for (; first != last; ++first) {
+      std::allocator_traits<Alloc>::destroy(alloc, first);
+    }
+  }
+}
+
+/*
+ *  Construct n copies of the value in uninitialized cells.
+ *  Returns the end of the new values. Nothing is left constructed
+ *  if an exception is thrown, here and in the functions below.
+ */
+template <typename Alloc, typename T>
+inline T* UninitializedFillN(Alloc& alloc, T* ptr, size_t n, const T& value) {
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    return TrivialFill(ptr, n, value);
+  }
+  T* start = ptr;
+  try {
+    for (; n > 0; --n, ++ptr) {
+      std::allocator_traits<Alloc>::construct(alloc, ptr, value);
+    }
+  } catch (...) {
+    DestroyRange(alloc, start, ptr);
+    throw;
+  }
+  return ptr;
+}
+
+/*
+ *  Value-initialize n uninitialized cells.
+ */
+template <typename Alloc, typename T>
+inline T* UninitializedValueConstructN(Alloc& alloc, T* ptr, size_t n) {
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    return TrivialFill(ptr, n, T());
+  }
+  T* start = ptr;
+  try {
+    for (; n > 0; --n, ++ptr) {
+      std::allocator_traits<Alloc>::construct(alloc, ptr);
+    }
+  } catch (...) {
+    DestroyRange(alloc, start, ptr);
+    throw;
+  }
+  return ptr;
+}
+
+/*
+ *  Copy the range [first, last) to uninitialized cells.
+ */
+template <typename Alloc, typename InputIterator, typename T>
+inline T* UninitializedCopy(Alloc& alloc, InputIterator first,
+                            InputIterator last, T* ptr) {
+  if constexpr (CopiesBitwise<Alloc, T>::value &&
+                IsBitwiseCopyable<InputIterator, T>::value) {
+    return TrivialCopy(first, last - first, ptr);
+  }
+  T* start = ptr;
+  try {
+    for (; first != last; ++first, ++ptr) {
+      std::allocator_traits<Alloc>::construct(alloc, ptr, *first);
+    }
+  } catch (...) {
+    DestroyRange(alloc, start, ptr);
+    throw;
+  }
+  return ptr;
+}
+
+/*
+ *  Move the range [first, last) to uninitialized cells.
+ */
+template <typename Alloc, typename T>
+inline T* UninitializedMove(Alloc& alloc, T* first, T* last, T* ptr) {
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    return TrivialCopy(first, last - first, ptr);
+  }
+  T* start = ptr;
+  try {
+    for (; first != last; ++first, ++ptr) {
+      std::allocator_traits<Alloc>::construct(alloc, ptr, std::move(*first));
+    }
+  } catch (...) {
+    DestroyRange(alloc, start, ptr);
+    throw;
+  }
+  return ptr;
+}
+
+/*
+ *  Relocate the range [first, last) to uninitialized cells. Values are
+ *  copied if their move constructor may throw, so the source stays intact
+ *  if an exception is thrown.
+ */
+template <typename Alloc, typename T>
+inline T* UninitializedMoveIfNoexcept(Alloc& alloc, T* first, T* last,
+                                      T* ptr) {
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    return TrivialCopy(first, last - first, ptr);
+  }
+  T* start = ptr;
+  try {
+    for (; first != last; ++first, ++ptr) {
+      std::allocator_traits<Alloc>::construct(alloc, ptr,
+                                              std::move_if_noexcept(*first));
+    }
+  } catch (...) {
+    DestroyRange(alloc, start, ptr);
+    throw;
+  }
+  return ptr;
+}
+
+/*
+ *  Shift the values [position, last) by count cells towards the end,
+ *  into spare capacity. The cells [position, position + count) become
+ *  uninitialized.
+ */
+template <typename Alloc, typename T>
+void OpenGap(Alloc& alloc, T* position, T* last, size_t count) {
+  size_t tail = last - position;
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    TrivialMove(position, tail, position + count);
+    return;
+  }
+  size_t to_uninitialized = std::min(count, tail);
+  T* moved_end = last + count;
+
+  UninitializedMove(alloc, last - to_uninitialized, last,
+                    moved_end - to_uninitialized);
+  try {
+    std::move_backward(position, last - to_uninitialized,
+                       moved_end - to_uninitialized);
+  } catch (...) {
+    DestroyRange(alloc, moved_end - to_uninitialized, moved_end);
+    throw;
+  }
+  DestroyRange(alloc, position, position + to_uninitialized);
+}
+
+/*
+ *  Undo OpenGap: move the shifted values back to the position.
+ */
+template <typename Alloc, typename T>
+void CloseGap(Alloc& alloc, T* position, T* last, size_t count) {
+  size_t tail = last - position;
+  if constexpr (CopiesBitwise<Alloc, T>::value) {
+    TrivialMove(position + count, tail, position);
+    return;
+  }
+  size_t to_uninitialized = std::min(count, tail);
+
+  UninitializedMove(alloc, position + count,
+                    position + count + to_uninitialized, position);
+  std::move(position + count + to_uninitialized, last + count,
+            position + to_uninitialized);
+  DestroyRange(alloc, last + count - to_uninitialized, last + count);
+}
+
+/*
+ *  Insert count values before the position into spare capacity behind
+ *  last. fill(ptr) constructs the values from ptr on and leaves none of
+ *  them initialized if it throws; the shifted values then move back.
+ */
+template <typename Alloc, typename T, typename Filler>
+void FillGap(Alloc& alloc, T* position, T* last, size_t count, Filler& fill) {
+  if (position == last) {
+    fill(position);
+    return;
+  }
+  OpenGap(alloc, position, last, count);
+  try {
+    fill(position);
+  } catch (...) {
+    CloseGap(alloc, position, last, count);
+    throw;
+  }
+}
+
+/*
+ *  Build the values of [first, last) with count new values inserted
+ *  before the position in the uninitialized array new_data. The new
+ *  values are constructed by fill(ptr) as for FillGap, the old ones are
+ *  relocated around them. If anything throws, new_data is left
+ *  uninitialized and the old values are intact.
+ */
+template <typename Alloc, typename T, typename Filler>
+void FillAround(Alloc& alloc, T* first, T* position, T* last, T* new_data,
+                size_t count, Filler& fill) {
+  T* new_position = new_data + (position - first);
+  fill(new_position);
+  try {
+    UninitializedMoveIfNoexcept(alloc, first, position, new_data);
+  } catch (...) {
+    DestroyRange(alloc, new_position, new_position + count);
+    throw;
+  }
+  try {
+    UninitializedMoveIfNoexcept(alloc, position, last, new_position + count);
+  } catch (...) {
+    DestroyRange(alloc, new_data, new_position + count);
+    throw;
+  }
+}
+
+// Growth policies of vector
+
+/*
+ *  A growth policy tells a vector how many cells to allocate.
+ *  Grow(size, count, value_size) is the capacity for inserting count values
+ *  into a full vector of size values. Fit(n, value_size) is the capacity
+ *  that an allocation of n cells really provides. Both saturate at the
+ *  maximum of size_t instead of overflowing.
+ */
+
+inline size_t SaturatingAdd(size_t lhs, size_t rhs) noexcept {
+  return lhs > std::numeric_limits<size_t>::max() - rhs
+             ? std::numeric_limits<size_t>::max()
+             : lhs + rhs;
+}
+
+/*
+ *  Round a block size up to its jemalloc size class: multiples of 16 up
+ *  to 128 bytes, then four classes for every power of two. This is the
+ *  usable size jemalloc gives a request of that many bytes; other
+ *  allocators round differently.
+ */
+inline size_t JemallocSizeClass(size_t bytes) noexcept {
+  if (bytes <= 16) {
+    return bytes <= 8 ? 8 : 16;
+  }
+  if (bytes <= 128) {
+    return (bytes + 15) & ~static_cast<size_t>(15);
+  }
+  size_t power = 128;  // the largest power of two below bytes
+  while (power <= (bytes - 1) / 2) {
+    power *= 2;
+  }
+  size_t step = power / 4;
+  if (bytes > std::numeric_limits<size_t>::max() - step) {
+    return bytes;
+  }
+  return (bytes + step - 1) & ~(step - 1);
+}
+
+/*
+ *  Double the capacity, as the standard library does.
+ */
+struct DoublingGrowth {
+  static size_t Grow(size_t size, size_t count, size_t) noexcept {
+    return SaturatingAdd(size, std::max(size, count));
+  }
+
+  static size_t Fit(size_t n, size_t) noexcept { return n; }
+};
+
+/*
+ *  Grow the capacity by half. At most a third of the memory is unused,
+ *  and a freed block can be reused by a later reallocation.
+ */
+struct OneAndHalfGrowth {
+  static size_t Grow(size_t size, size_t count, size_t) noexcept {
+    return SaturatingAdd(size, std::max(size / 2, count));
+  }
+
+  static size_t Fit(size_t n, size_t) noexcept { return n; }
+};
+
+/*
+ *  Grow the capacity by half and round the block up to its jemalloc size
+ *  class, so the bytes jemalloc would spend on rounding become capacity.
+ *  The table is fixed: the allocator interface can't report usable sizes.
+ *  Under other allocators, glibc malloc included, blocks are rounded to
+ *  other sizes and this policy only grows a little faster than
+ *  OneAndHalfGrowth.
+ */
+struct JemallocGrowth {
+  static size_t Grow(size_t size, size_t count, size_t value_size) noexcept {
+    return Fit(OneAndHalfGrowth::Grow(size, count, value_size), value_size);
+  }
+
+  static size_t Fit(size_t n, size_t value_size) noexcept {
+    if (n == 0 || n > std::numeric_limits<size_t>::max() / value_size) {
+      return n;
+    }
+    return JemallocSizeClass(n * value_size) / value_size;
+  }
+};
+
+/*
+ *  Size of a cache line. Data written by different threads is kept
+ *  this far apart, so a write doesn't invalidate the other thread's line.
+ */
+constexpr size_t kCacheLineSize = 64;
+
+/*
+ *  Hint to the CPU that the thread is spinning on a shared variable.
+ */
+inline void CpuRelax(void) noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
 }  // namespace s21
 
 #endif  // INCLUDE_S21_UTILS_H_
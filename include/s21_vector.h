@@ -3,16 +3,26 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utils.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = DoublingGrowth>
 class vector {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -21,14 +31,27 @@ class vector {
   using const_pointer = const T *;
   using size_type = size_t;
 
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "vector: allocator value_type must be T");
+  static_assert(std::is_same<typename AllocTraits::pointer, T *>::value,
+                "vector: allocator must use raw pointers");
+
   vector(void);
-  vector(size_type len);
+  explicit vector(const allocator_type &alloc);
+  vector(size_type len, const allocator_type &alloc = allocator_type());
   vector(vector const &vect);
-  vector(vector<T> &&v);
-  vector(std::initializer_list<value_type> const &items);
+  vector(vector const &vect, const allocator_type &alloc);
+  vector(vector &&v) noexcept;
+  vector(vector &&v, const allocator_type &alloc);
+  vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type());
   ~vector(void);
   vector &operator=(const vector &v);
-  vector &operator=(vector &&v) noexcept;
+  vector &operator=(vector &&v) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value);
+
+  allocator_type get_allocator(void) const noexcept;
 
   reference at(size_type pos);
   const_reference at(size_type pos) const;
@@ -52,12 +75,29 @@ class vector {
   void reserve(size_type size);
   size_type capacity(void) const noexcept;
   void shrink_to_fit(void);
+  size_type slack_bytes(void) const noexcept;
 
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  iterator insert(iterator pos, size_type count, const_reference value);
+  template <typename InputIterator,
+            typename = typename std::iterator_traits<
+                InputIterator>::iterator_category>
+  iterator insert(iterator pos, InputIterator first, InputIterator last);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void resize_default_init(size_type count);
+  void resize_uninitialized(size_type count);
   void swap(vector &other) noexcept;
 
   template <typename... Args>
@@ -65,19 +105,42 @@ class vector {
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
+ private:
+  // Bulk kernels bypass the allocator's construct and destroy,
+  // so they are used only when the allocator doesn't customize them.
+  static constexpr bool kBitwiseCopyable = CopiesBitwise<Allocator, T>::value;
+  static constexpr bool kTriviallyDestructible =
+      DestroysTrivially<Allocator, T>::value;
+  // The storage is resized by the allocator without copying elements.
+  static constexpr bool kReallocatable =
+      kBitwiseCopyable && HasReallocate<Allocator, T>::value;
+
  private:
   pointer allocate(size_type n);
-  void deallocate(pointer ptr);
-  void construct(pointer ptr, const_reference value);
+  void deallocate(pointer ptr, size_type n);
+  void reallocate(size_type new_cap);
+  template <typename... Args>
+  void construct(pointer ptr, Args &&...args);
   void destroy(pointer ptr);
   void destroy(pointer start, pointer finish);
-  pointer uninitialized_fill_n(pointer ptr, size_type n,
-                               const value_type &value);
+  pointer uninitialized_default_construct_n(pointer ptr, size_type n);
+  template <typename... Args>
+  void realloc_insert(iterator position, Args &&...args);
+  template <typename Filler>
+  iterator insert_aux(iterator position, size_type count, Filler fill);
   template <typename InputIterator>
-  pointer uninitialized_copy(InputIterator first, InputIterator last,
-                             pointer ptr);
+  iterator insert_range(iterator position, InputIterator first,
+                        InputIterator last, std::input_iterator_tag);
+  template <typename ForwardIterator>
+  iterator insert_range(iterator position, ForwardIterator first,
+                        ForwardIterator last, std::forward_iterator_tag);
+  size_type grow_capacity(size_type count) const;
+  size_type fit_capacity(size_type n) const;
+  void release(void) noexcept;
+  void swap_data(vector &other) noexcept;
 
  private:
+  allocator_type allocator_;
   pointer data_;
   size_type size_;
   size_type capacity_;
@@ -85,74 +148,129 @@ class vector {
 
 // Ctors, Dtor, overloaded operator=
 
-template <typename T>
-vector<T>::vector(void) : data_(nullptr), size_(0), capacity_(0) {}
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(void)
+    : allocator_(), data_(nullptr), size_(0), capacity_(0) {}
+
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(const allocator_type &alloc)
+    : allocator_(alloc), data_(nullptr), size_(0), capacity_(0) {}
 
-template <typename T>
-vector<T>::vector(size_type n) : data_(nullptr), size_(n), capacity_(n) {
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(size_type n, const allocator_type &alloc)
+    : allocator_(alloc), data_(nullptr), size_(n), capacity_(n) {
   data_ = allocate(size_);
   try {
-    uninitialized_fill_n(data_, n, value_type());
+    UninitializedValueConstructN(allocator_, data_, n);
   } catch (...) {
-    deallocate(data_);
+    deallocate(data_, capacity_);
     throw;
   }
 }
 
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items)
-    : data_(nullptr), size_(items.size()), capacity_(items.size()) {
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(std::initializer_list<value_type> const &items,
+                        const allocator_type &alloc)
+    : allocator_(alloc),
+      data_(nullptr),
+      size_(items.size()),
+      capacity_(items.size()) {
   data_ = allocate(size_);
   try {
-    uninitialized_copy(items.begin(), items.end(), data_);
+    UninitializedCopy(allocator_, items.begin(), items.end(), data_);
   } catch (...) {
-    deallocate(data_);
+    deallocate(data_, capacity_);
     throw;
   }
 }
 
-template <typename T>
-vector<T>::vector(const vector &other)
-    : data_(nullptr), size_(other.size_), capacity_(other.capacity_) {
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(const vector &other)
+    : vector(other, AllocTraits::select_on_container_copy_construction(
+                        other.allocator_)) {}
+
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(const vector &other, const allocator_type &alloc)
+    : allocator_(alloc),
+      data_(nullptr),
+      size_(other.size_),
+      capacity_(other.capacity_) {
   data_ = allocate(capacity_);
   try {
-    uninitialized_copy(other.begin(), other.end(), data_);
+    UninitializedCopy(allocator_, other.begin(), other.end(), data_);
   } catch (...) {
-    deallocate(data_);
+    deallocate(data_, capacity_);
     throw;
   }
 }
 
-template <typename T>
-vector<T>::vector(vector<T> &&other)
-    : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(vector &&other) noexcept
+    : allocator_(std::move(other.allocator_)),
+      data_(other.data_),
+      size_(other.size_),
+      capacity_(other.capacity_) {
   other.data_ = nullptr;
   other.size_ = 0;
   other.capacity_ = 0;
 }
 
-template <typename T>
-vector<T>::~vector(void) {
-  destroy(data_, data_ + size_);
-  deallocate(data_);
+/*
+ *  Move constructor with a given allocator. Elements are moved one by one
+ *  if the allocator can't deallocate the memory of the other vector.
+ */
+template <typename T, typename A, typename G>
+vector<T, A, G>::vector(vector &&other, const allocator_type &alloc)
+    : allocator_(alloc), data_(nullptr), size_(0), capacity_(0) {
+  if (AllocTraits::is_always_equal::value || allocator_ == other.allocator_) {
+    swap_data(other);
+  } else {
+    data_ = allocate(other.size_);
+    capacity_ = other.size_;
+    try {
+      UninitializedMove(allocator_, other.data_, other.data_ + other.size_,
+                        data_);
+    } catch (...) {
+      deallocate(data_, capacity_);
+      throw;
+    }
+    size_ = other.size_;
+    other.clear();
+  }
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(const vector &other) {
+template <typename T, typename A, typename G>
+vector<T, A, G>::~vector(void) {
+  release();
+}
+
+/*
+ *  Copy assignment. The allocator of the other vector is taken
+ *  if it propagates on copy assignment.
+ */
+template <typename T, typename A, typename G>
+vector<T, A, G> &vector<T, A, G>::operator=(const vector &other) {
   if (this == &other) {
     return *this;
   }
 
+  if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+    if (!AllocTraits::is_always_equal::value &&
+        allocator_ != other.allocator_) {
+      release();
+    }
+    allocator_ = other.allocator_;
+  }
+
   if (other.size_ > capacity_) {
     pointer new_data = allocate(other.size_);
     try {
-      uninitialized_copy(other.begin(), other.end(), new_data);
+      UninitializedCopy(allocator_, other.begin(), other.end(), new_data);
     } catch (...) {
-      deallocate(new_data);
+      deallocate(new_data, other.size_);
       throw;
     }
-    destroy(data_, data_ + size_);
-    deallocate(data_);
+    release();
     data_ = new_data;
     capacity_ = other.size_;
   } else if (other.size_ <= size_) {
@@ -160,340 +278,563 @@ vector<T> &vector<T>::operator=(const vector &other) {
     destroy(data_ + other.size_, data_ + size_);
   } else {
     std::copy(other.data_, other.data_ + size_, data_);
-    uninitialized_copy(other.data_ + size_, other.data_ + other.size_,
-                       data_ + size_);
+    UninitializedCopy(allocator_, other.data_ + size_,
+                      other.data_ + other.size_, data_ + size_);
   }
   size_ = other.size_;
 
   return *this;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&other) noexcept {
-  swap(other);
+/*
+ *  Move assignment. The storage is exchanged if the allocator propagates
+ *  or the allocators are equal, otherwise the elements are moved one by one.
+ */
+template <typename T, typename A, typename G>
+vector<T, A, G> &vector<T, A, G>::operator=(vector &&other) noexcept(
+    AllocTraits::propagate_on_container_move_assignment::value ||
+    AllocTraits::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+
+  if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+    std::swap(allocator_, other.allocator_);
+    swap_data(other);
+  } else if (AllocTraits::is_always_equal::value ||
+             allocator_ == other.allocator_) {
+    swap_data(other);
+  } else {
+    clear();
+    insert(end(), std::make_move_iterator(other.begin()),
+           std::make_move_iterator(other.end()));
+    other.clear();
+  }
+
   return *this;
 }
 
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::allocator_type vector<T, A, G>::get_allocator(
+    void) const noexcept {
+  return allocator_;
+}
+
 // Element access
 
-template <typename T>
-inline typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::reference vector<T, A, G>::at(size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("vector: at out of range");
   }
   return data_[pos];
 }
 
-template <typename T>
-inline typename vector<T>::const_reference vector<T>::at(size_type pos) const {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_reference vector<T, A, G>::at(
+    size_type pos) const {
   if (pos >= size_) {
     throw std::out_of_range("vector: at out of range");
   }
   return data_[pos];
 }
 
-template <typename T>
-inline typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::reference vector<T, A, G>::operator[](
+    size_type pos) {
   return data_[pos];
 }
 
-template <typename T>
-inline typename vector<T>::const_reference vector<T>::operator[](
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_reference vector<T, A, G>::operator[](
     size_type pos) const {
   return data_[pos];
 }
 
-template <typename T>
-inline typename vector<T>::reference vector<T>::front(void) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::reference vector<T, A, G>::front(void) {
   return data_[0];
 }
 
-template <typename T>
-inline typename vector<T>::const_reference vector<T>::front(void) const {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_reference vector<T, A, G>::front(
+    void) const {
   return data_[0];
 }
 
-template <typename T>
-inline typename vector<T>::reference vector<T>::back(void) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::reference vector<T, A, G>::back(void) {
   return data_[size_ - 1];
 }
 
-template <typename T>
-inline typename vector<T>::const_reference vector<T>::back(void) const {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_reference vector<T, A, G>::back(
+    void) const {
   return data_[size_ - 1];
 }
 
-template <typename T>
-inline typename vector<T>::pointer vector<T>::data(void) noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::pointer vector<T, A, G>::data(void) noexcept {
   return data_;
 }
 
-template <typename T>
-inline typename vector<T>::const_pointer vector<T>::data(void) const noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_pointer vector<T, A, G>::data(
+    void) const noexcept {
   return data_;
 }
 
 // ITERATORS
 
-template <typename T>
-inline typename vector<T>::iterator vector<T>::begin(void) noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::begin(
+    void) noexcept {
   return data_;
 }
 
-template <typename T>
-inline typename vector<T>::const_iterator vector<T>::begin(
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_iterator vector<T, A, G>::begin(
     void) const noexcept {
   return data_;
 }
 
-template <typename T>
-inline typename vector<T>::iterator vector<T>::end(void) noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::end(void) noexcept {
   return data_ + size_;
 }
 
-template <typename T>
-inline typename vector<T>::const_iterator vector<T>::end(void) const noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::const_iterator vector<T, A, G>::end(
+    void) const noexcept {
   return data_ + size_;
 }
 
 // CAPACITY
 
-template <typename T>
-inline bool vector<T>::empty(void) const noexcept {
+template <typename T, typename A, typename G>
+inline bool vector<T, A, G>::empty(void) const noexcept {
   return size_ == 0;
 }
 
-template <typename T>
-inline typename vector<T>::size_type vector<T>::size(void) const noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::size(
+    void) const noexcept {
   return size_;
 }
 
-template <typename T>
-inline typename vector<T>::size_type vector<T>::max_size(void) const noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::max_size(
+    void) const noexcept {
   /*
    * return std::numeric_limits<size_type>::max() / 2 / sizeof(T);
    */
 
-  return std::allocator<T>().max_size();
+  return AllocTraits::max_size(allocator_);
 }
 
-template <typename T>
-inline void vector<T>::reserve(size_type new_cap) {
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::reserve(size_type new_cap) {
   if (new_cap > capacity_) {
-    pointer new_data = allocate(new_cap);
-    try {
-      uninitialized_copy(data_, data_ + size_, new_data);
-    } catch (...) {
-      deallocate(new_data);
-      throw;
-    }
-    destroy(data_, data_ + size_);
-    deallocate(data_);
-    data_ = new_data;
-    capacity_ = new_cap;
+    reallocate(fit_capacity(new_cap));
   }
 }
 
-template <typename T>
-inline typename vector<T>::size_type vector<T>::capacity(void) const noexcept {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::capacity(
+    void) const noexcept {
   return capacity_;
 }
 
-template <typename T>
-inline void vector<T>::shrink_to_fit(void) {
-  if (capacity_ > size_) {
-    pointer new_data = allocate(size_);
-    try {
-      uninitialized_copy(data_, data_ + size_, new_data);
-    } catch (...) {
-      deallocate(new_data);
-      throw;
-    }
-    destroy(data_, data_ + size_);
-    deallocate(data_);
-    data_ = new_data;
-    capacity_ = size_;
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::shrink_to_fit(void) {
+  size_type new_cap = fit_capacity(size_);
+  if (capacity_ > new_cap) {
+    reallocate(new_cap);
   }
 }
 
+/*
+ *  Bytes allocated for cells that hold no element.
+ */
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::slack_bytes(
+    void) const noexcept {
+  return (capacity_ - size_) * sizeof(value_type);
+}
+
 // MODIFIERS
 
-template <typename T>
-inline void vector<T>::clear() {
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::clear() {
   destroy(data_, data_ + size_);
   size_ = 0;
 }
 
-template <typename T>
-inline typename vector<T>::iterator vector<T>::insert(iterator position,
-                                                      const_reference value) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::insert(
+    iterator position, const_reference value) {
+  return emplace(position, value);
+}
+
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::insert(
+    iterator position, value_type &&value) {
+  return emplace(position, std::move(value));
+}
+
+/*
+ *  Insert count copies of the value before the position.
+ */
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::insert(
+    iterator position, size_type count, const_reference value) {
+  if (count == 0) {
+    return position;
+  }
+  value_type tmp(value);  // value may refer to an element of the vector
+  return insert_aux(position, count, [this, count, &tmp](pointer ptr) {
+    UninitializedFillN(allocator_, ptr, count, tmp);
+  });
+}
+
+/*
+ *  Insert copies of the elements from the range [first, last)
+ *  before the position.
+ */
+template <typename T, typename A, typename G>
+template <typename InputIterator, typename>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::insert(
+    iterator position, InputIterator first, InputIterator last) {
+  return insert_range(
+      position, first, last,
+      typename std::iterator_traits<InputIterator>::iterator_category());
+}
+
+/*
+ *  Construct an element in place before the position.
+ */
+template <typename T, typename A, typename G>
+template <typename... Args>
+inline typename vector<T, A, G>::iterator vector<T, A, G>::emplace(
+    iterator position, Args &&...args) {
   size_type diff = position - data_;
   if (size_ != capacity_ && position == end()) {
-    construct(data_ + size_, value);
+    construct(data_ + size_, std::forward<Args>(args)...);
     ++size_;
   } else if (size_ < capacity_) {
-    construct(data_ + size_, data_[size_ - 1]);
+    // args may refer to an element of the vector
+    value_type tmp(std::forward<Args>(args)...);
+    construct(data_ + size_, std::move(data_[size_ - 1]));
     ++size_;
-    std::copy_backward(position, data_ + size_ - 2, data_ + size_ - 1);
-    *position = value;
+    std::move_backward(position, data_ + size_ - 2, data_ + size_ - 1);
+    *position = std::move(tmp);
   } else {
-    size_type new_capacity = size_ == 0 ? 1 : 2 * size_;
-    pointer new_data = allocate(new_capacity);
-    pointer last = new_data;
-    pointer except_ptr = new_data;
-    try {
-      last = uninitialized_copy(data_, position, new_data);
-      except_ptr = last;
-      construct(last, value);
-      ++last;
-      ++except_ptr;
-      last = uninitialized_copy(position, data_ + size_, last);
-    } catch (...) {
-      destroy(new_data, except_ptr);
-      deallocate(new_data);
-      throw;
-    }
-    destroy(data_, data_ + size_);
-    deallocate(data_);
-    data_ = new_data;
-    ++size_;
-    capacity_ = new_capacity;
+    realloc_insert(position, std::forward<Args>(args)...);
   }
 
   return data_ + diff;
 }
 
-template <typename T>
-inline void vector<T>::erase(iterator pos) {
-  if (pos != end()) {
-    std::copy(pos + 1, data_ + size_, pos);
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::erase(iterator pos) {
+  if constexpr (kBitwiseCopyable) {
+    TrivialMove(pos + 1, data_ + size_ - pos - 1, pos);
+  } else if (pos != end()) {
+    std::move(pos + 1, data_ + size_, pos);
   }
   --size_;
   destroy(data_ + size_);
 }
 
-template <typename T>
-inline void vector<T>::push_back(const_reference value) {
+/*
+ *  Erase the elements [first, last) with a single shift of the tail.
+ *  Returns the iterator following the last erased element.
+ */
+template <typename T, typename A, typename G>
+typename vector<T, A, G>::iterator vector<T, A, G>::erase(iterator first,
+                                                          iterator last) {
+  if (first != last) {
+    pointer new_end;
+    if constexpr (kBitwiseCopyable) {
+      new_end = TrivialMove(last, data_ + size_ - last, first);
+    } else {
+      new_end = std::move(last, data_ + size_, first);
+    }
+    destroy(new_end, data_ + size_);
+    size_ = new_end - data_;
+  }
+  return first;
+}
+
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/*
+ *  Construct an element in place at the end.
+ */
+template <typename T, typename A, typename G>
+template <typename... Args>
+inline typename vector<T, A, G>::reference vector<T, A, G>::emplace_back(
+    Args &&...args) {
   if (size_ != capacity_) {
-    construct(data_ + size_, value);
+    construct(data_ + size_, std::forward<Args>(args)...);
     ++size_;
   } else {
-    size_type new_capacity = size_ == 0 ? 1 : 2 * size_;
-    pointer new_data = allocate(new_capacity);
-    try {
-      uninitialized_copy(data_, data_ + size_, new_data);
-    } catch (...) {
-      deallocate(new_data);
-      throw;
-    }
-    try {
-      construct(new_data + size_, value);
-    } catch (...) {
-      destroy(new_data, new_data + size_);
-      deallocate(new_data);
-      throw;
-    }
-    destroy(data_, data_ + size_);
-    deallocate(data_);
-    data_ = new_data;
-    ++size_;
-    capacity_ = new_capacity;
+    realloc_insert(end(), std::forward<Args>(args)...);
   }
+
+  return data_[size_ - 1];
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename A, typename G>
+void vector<T, A, G>::pop_back() {
   --size_;
   destroy(data_ + size_);
 }
 
-template <typename T>
-void vector<T>::swap(vector<T> &other) noexcept {
-  std::swap(data_, other.data_);
-  std::swap(size_, other.size_);
-  std::swap(capacity_, other.capacity_);
+/*
+ *  Resize the vector to count elements. New elements are value-initialized.
+ */
+template <typename T, typename A, typename G>
+void vector<T, A, G>::resize(size_type count) {
+  if (count <= size_) {
+    destroy(data_ + count, data_ + size_);
+    size_ = count;
+  } else {
+    size_type n = count - size_;
+    if constexpr (kReallocatable) {
+      if (capacity_ - size_ < n) {
+        reallocate(grow_capacity(n));
+      }
+    }
+    insert_aux(end(), n, [this, n](pointer ptr) {
+      UninitializedValueConstructN(allocator_, ptr, n);
+    });
+  }
+}
+
+/*
+ *  Resize the vector to count elements. New elements are copies of value.
+ */
+template <typename T, typename A, typename G>
+void vector<T, A, G>::resize(size_type count, const_reference value) {
+  if (count <= size_) {
+    destroy(data_ + count, data_ + size_);
+    size_ = count;
+  } else if constexpr (kReallocatable) {
+    // value may refer to an element of the vector
+    value_type tmp(value);
+    if (count > capacity_) {
+      reallocate(grow_capacity(count - size_));
+    }
+    insert(end(), count - size_, tmp);
+  } else {
+    insert(end(), count - size_, value);
+  }
+}
+
+/*
+ *  Resize the vector to count elements. New elements are
+ *  default-initialized, so values of trivial types are left indeterminate.
+ */
+template <typename T, typename A, typename G>
+void vector<T, A, G>::resize_default_init(size_type count) {
+  if (count <= size_) {
+    destroy(data_ + count, data_ + size_);
+    size_ = count;
+  } else {
+    size_type n = count - size_;
+    if constexpr (kReallocatable) {
+      if (capacity_ - size_ < n) {
+        reallocate(grow_capacity(n));
+      }
+    }
+    insert_aux(end(), n, [this, n](pointer ptr) {
+      uninitialized_default_construct_n(ptr, n);
+    });
+  }
+}
+
+/*
+ *  Resize the vector of a trivial type to count elements without touching
+ *  the new cells. They must be written before they are read.
+ */
+template <typename T, typename A, typename G>
+void vector<T, A, G>::resize_uninitialized(size_type count) {
+  static_assert(std::is_trivial<value_type>::value && kBitwiseCopyable,
+                "vector: resize_uninitialized requires a trivial type");
+  if (count > capacity_) {
+    reserve(grow_capacity(count - size_));
+  }
+  size_ = count;
+}
+
+template <typename T, typename A, typename G>
+void vector<T, A, G>::swap(vector &other) noexcept {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(allocator_, other.allocator_);
+  }
+  swap_data(other);
 }
 
 // INSERT MANY
 
-template <typename T>
+/*
+ *  Construct the arguments in place before the position with a single
+ *  shift of the tail. The arguments must not refer to elements of the vector
+ *  at or after the position.
+ */
+template <typename T, typename A, typename G>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(iterator pos,
-                                                    Args &&...args) {
-  vector<value_type> temp{args...};
-  iterator insert_pos = begin() + (pos - begin());
-  for (size_t i = 0; i < temp.size(); i++, insert_pos++) {
-    insert_pos = insert(insert_pos, temp[i]);
-  }
+typename vector<T, A, G>::iterator vector<T, A, G>::insert_many(
+    iterator pos, Args &&...args) {
+  iterator first = insert_aux(pos, sizeof...(Args), [&](pointer ptr) {
+    pointer start = ptr;
+    try {
+      ((construct(ptr, std::forward<Args>(args)), ++ptr), ...);
+    } catch (...) {
+      destroy(start, ptr);
+      throw;
+    }
+  });
 
-  return insert_pos;
+  return first + sizeof...(Args);
 }
 
-template <typename T>
+template <typename T, typename A, typename G>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  insert_many(end(), args...);
+void vector<T, A, G>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
 }
 
 // Auxiliary private methods
 
 /*
  *  Allocate uninitialized memory for n cells.
+ *  No memory is allocated for zero cells.
  */
-template <typename T>
-inline typename vector<T>::pointer vector<T>::allocate(size_type n) {
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::pointer vector<T, A, G>::allocate(
+    size_type n) {
   if (n > max_size()) {
     throw std::length_error("cannot create vector larger then max_size()");
   }
-  return static_cast<pointer>(operator new(sizeof(value_type) * n));
+  return n != 0 ? AllocTraits::allocate(allocator_, n) : nullptr;
 }
 
 /*
- *  Deallocate array.
+ *  Deallocate array of n cells.
  */
-template <typename T>
-inline void vector<T>::deallocate(pointer ptr) {
-  operator delete(static_cast<void *>(ptr));
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::deallocate(pointer ptr, size_type n) {
+  if (ptr != nullptr) {
+    AllocTraits::deallocate(allocator_, ptr, n);
+  }
+}
+
+/*
+ *  Move the elements to storage of new_cap cells, new_cap >= size().
+ *  An allocator with reallocate() resizes the storage of bitwise copyable
+ *  elements itself, possibly without copying them.
+ */
+template <typename T, typename A, typename G>
+void vector<T, A, G>::reallocate(size_type new_cap) {
+  if constexpr (kReallocatable) {
+    if (data_ != nullptr && new_cap != 0) {
+      if (new_cap > max_size()) {
+        throw std::length_error("cannot create vector larger then max_size()");
+      }
+      data_ = allocator_.reallocate(data_, capacity_, new_cap);
+      capacity_ = new_cap;
+      return;
+    }
+  }
+  pointer new_data = allocate(new_cap);
+  try {
+    UninitializedMoveIfNoexcept(allocator_, data_, data_ + size_, new_data);
+  } catch (...) {
+    deallocate(new_data, new_cap);
+    throw;
+  }
+  destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_cap;
 }
 
 /*
- *  Construct value.
+ *  Construct value from the arguments.
  */
-template <typename T>
-inline void vector<T>::construct(pointer ptr, const_reference value) {
-  new (ptr) value_type(value);
+template <typename T, typename A, typename G>
+template <typename... Args>
+inline void vector<T, A, G>::construct(pointer ptr, Args &&...args) {
+  AllocTraits::construct(allocator_, ptr, std::forward<Args>(args)...);
 }
 
 /*
  *  Destroy objects in the range.
+ *  Nothing to do for trivially destructible types.
  */
-template <typename T>
-inline void vector<T>::destroy(pointer start, pointer finish) {
-  while (start != finish) {
-    start->~value_type();
-    ++start;
-  }
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::destroy(pointer start, pointer finish) {
+  DestroyRange(allocator_, start, finish);
 }
 
 /*
  *  Destroy the only single object.
  */
-template <typename T>
-inline void vector<T>::destroy(pointer ptr) {
-  ptr->~value_type();
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::destroy(pointer ptr) {
+  if constexpr (!kTriviallyDestructible) {
+    AllocTraits::destroy(allocator_, ptr);
+  }
 }
 
 /*
- *  Initialize n array cells with the value passed as an argument.
- *  Returns the address behind the last initialized cell.
+ *  Destroy the elements and deallocate the array.
  */
-template <typename T>
-inline typename vector<T>::pointer vector<T>::uninitialized_fill_n(
-    pointer ptr, size_type n, const value_type &value) {
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::release(void) noexcept {
+  destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+/*
+ *  Exchange the storage, but not the allocators.
+ */
+template <typename T, typename A, typename G>
+inline void vector<T, A, G>::swap_data(vector &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+/*
+ *  Default-initialize n array cells. Nothing is done for trivially
+ *  default constructible types.
+ */
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::pointer
+vector<T, A, G>::uninitialized_default_construct_n(pointer ptr, size_type n) {
+  if constexpr (!UsesDefaultConstruct<A, T>::value) {
+    return UninitializedValueConstructN(allocator_, ptr, n);
+  } else if constexpr (std::is_trivially_default_constructible<T>::value) {
+    return ptr + n;
+  }
   pointer tmp = ptr;
   while (n > 0) {
     try {
-      new (ptr) value_type(value);
+      new (static_cast<void *>(ptr)) value_type;
       ++ptr;
       --n;
     } catch (...) {
@@ -505,25 +846,144 @@ inline typename vector<T>::pointer vector<T>::uninitialized_fill_n(
 }
 
 /*
- *  Copy values from the range [first, last)  and initialize cells with these
- * values. Returns the address behind the last initialized cell.
+ *  Allocate a larger array, construct a new element from the arguments
+ *  before the position and relocate the old elements around it.
+ *  The vector is left unchanged if an exception is thrown.
  */
-template <typename T>
-template <typename InputIterator>
-inline typename vector<T>::pointer vector<T>::uninitialized_copy(
-    InputIterator first, InputIterator last, pointer ptr) {
-  pointer tmp = ptr;
-  while (first != last) {
+template <typename T, typename A, typename G>
+template <typename... Args>
+void vector<T, A, G>::realloc_insert(iterator position, Args &&...args) {
+  if constexpr (kReallocatable) {
+    if (data_ != nullptr) {
+      // args may refer to an element of the vector
+      value_type tmp(std::forward<Args>(args)...);
+      size_type diff = position - data_;
+      reallocate(grow_capacity(1));
+      TrivialMove(data_ + diff, size_ - diff, data_ + diff + 1);
+      construct(data_ + diff, tmp);
+      ++size_;
+      return;
+    }
+  }
+  insert_aux(position, 1, [&](pointer ptr) {
+    construct(ptr, std::forward<Args>(args)...);
+  });
+}
+
+/*
+ *  Insert count elements before the position with one capacity check.
+ *  The elements are constructed by fill(ptr), which initializes count cells
+ *  starting at ptr and leaves none of them initialized if it throws.
+ *  Returns the iterator to the first inserted element.
+ */
+template <typename T, typename A, typename G>
+template <typename Filler>
+typename vector<T, A, G>::iterator vector<T, A, G>::insert_aux(
+    iterator position, size_type count, Filler fill) {
+  size_type diff = position - data_;
+  if (count == 0) {
+    return position;
+  }
+
+  if (capacity_ - size_ >= count) {
+    FillGap(allocator_, position, end(), count, fill);
+    size_ += count;
+  } else {
+    size_type new_capacity = grow_capacity(count);
+    pointer new_data = allocate(new_capacity);
     try {
-      new (ptr) value_type(*first);
-      ++ptr;
-      ++first;
+      FillAround(allocator_, data_, position, end(), new_data, count, fill);
     } catch (...) {
-      destroy(tmp, ptr);
+      deallocate(new_data, new_capacity);
       throw;
     }
+    destroy(data_, data_ + size_);
+    deallocate(data_, capacity_);
+    data_ = new_data;
+    size_ += count;
+    capacity_ = new_capacity;
   }
-  return ptr;
+
+  return data_ + diff;
+}
+
+/*
+ *  Insert elements of a single pass range one by one at the end
+ *  and rotate them into place.
+ */
+template <typename T, typename A, typename G>
+template <typename InputIterator>
+typename vector<T, A, G>::iterator vector<T, A, G>::insert_range(
+    iterator position, InputIterator first, InputIterator last,
+    std::input_iterator_tag) {
+  size_type diff = position - data_;
+  size_type old_size = size_;
+  try {
+    while (first != last) {
+      emplace_back(*first);
+      ++first;
+    }
+  } catch (...) {
+    destroy(data_ + old_size, data_ + size_);
+    size_ = old_size;
+    throw;
+  }
+  std::rotate(data_ + diff, data_ + old_size, data_ + size_);
+
+  return data_ + diff;
+}
+
+/*
+ *  Insert elements of a multi pass range with a single shift of the tail.
+ */
+template <typename T, typename A, typename G>
+template <typename ForwardIterator>
+typename vector<T, A, G>::iterator vector<T, A, G>::insert_range(
+    iterator position, ForwardIterator first, ForwardIterator last,
+    std::forward_iterator_tag) {
+  size_type count = std::distance(first, last);
+  return insert_aux(position, count, [this, first, last](pointer ptr) {
+    UninitializedCopy(allocator_, first, last, ptr);
+  });
+}
+
+/*
+ *  Capacity for inserting count elements into the full vector,
+ *  as chosen by the growth policy.
+ */
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::grow_capacity(
+    size_type count) const {
+  if (max_size() - size_ < count) {
+    throw std::length_error("vector: insert exceeds max_size()");
+  }
+  size_type new_capacity = G::Grow(size_, count, sizeof(value_type));
+  return new_capacity > max_size() ? max_size() : new_capacity;
+}
+
+/*
+ *  Capacity that an allocation of n cells provides under the growth policy.
+ */
+template <typename T, typename A, typename G>
+inline typename vector<T, A, G>::size_type vector<T, A, G>::fit_capacity(
+    size_type n) const {
+  size_type fitted = G::Fit(n, sizeof(value_type));
+  return fitted > max_size() ? n : fitted;
+}
+
+/*
+ *  Erase the elements that satisfy the predicate. The kept elements are
+ *  compacted in one stable pass and the tail is destroyed once.
+ *  Returns the number of erased elements.
+ */
+template <typename T, typename A, typename G, typename Predicate>
+typename vector<T, A, G>::size_type erase_if(vector<T, A, G> &vect,
+                                             Predicate pred) {
+  typename vector<T, A, G>::iterator first =
+      std::remove_if(vect.begin(), vect.end(), pred);
+  typename vector<T, A, G>::size_type count = vect.end() - first;
+  vect.erase(first, vect.end());
+  return count;
 }
 
 }  // namespace s21
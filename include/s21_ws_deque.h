@@ -0,0 +1,274 @@
+#ifndef INCLUDE_S21_WS_DEQUE_H_
+#define INCLUDE_S21_WS_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "s21_utils.h"
+
+namespace s21 {
+
+/*
+ *  Work-stealing deque after Chase and Lev, with the memory orders of
+ *  Le, Pop, Cohen and Zappa Nardelli. One owner thread pushes and pops at
+ *  the bottom like a stack, any number of thieves steal from the top.
+ *
+ *  The owner's push and pop touch only bottom_ unless the deque is about
+ *  to run empty, so a busy owner runs without atomic read-modify-writes.
+ *  Thieves take the top with a compare-and-swap on top_, and the owner
+ *  joins that race only for the last value.
+ *
+ *  The cells are a circular array that the owner doubles when it is
+ *  full. A thief may still read the old array, so old arrays are kept
+ *  until the deque is destroyed; together they are smaller than the
+ *  current one. A thief reads a value before it knows it has won it, so
+ *  T must be trivially copyable, typically a pointer to a task.
+ *
+ *  push, try_pop and the destructor may be called only by the owner.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ws_deque final {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(std::is_same<typename AllocTraits::value_type, T>::value,
+                "ws_deque: allocator value_type must be T");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ws_deque: T must be trivially copyable");
+
+  explicit ws_deque(size_type capacity = 64,
+                    const allocator_type &alloc = allocator_type());
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+  ~ws_deque(void);
+
+  allocator_type get_allocator(void) const noexcept;
+
+  bool empty(void) const noexcept;
+  size_type size(void) const noexcept;
+  size_type capacity(void) const noexcept;
+
+  void push(const_reference value);
+  bool try_pop(reference out) noexcept;
+  bool try_steal(reference out) noexcept;
+
+ private:
+  using Cell = std::atomic<T>;
+
+  struct Array {
+    Cell *cells;
+    size_type mask;
+    Array *previous;
+
+    T load(int64_t i) const noexcept {
+      return cells[i & mask].load(std::memory_order_relaxed);
+    }
+    void store(int64_t i, T value) noexcept {
+      cells[i & mask].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  using CellAllocator = typename AllocTraits::template rebind_alloc<Cell>;
+  using CellTraits = std::allocator_traits<CellAllocator>;
+  using ArrayAllocator = typename AllocTraits::template rebind_alloc<Array>;
+  using ArrayTraits = std::allocator_traits<ArrayAllocator>;
+
+  Array *create_array(size_type capacity, Array *previous);
+  Array *grow(Array *array, int64_t top, int64_t bottom);
+
+ private:
+  allocator_type allocator_;
+
+  // Written by thieves and, for the last value, by the owner.
+  alignas(kCacheLineSize) std::atomic<int64_t> top_;
+
+  // Written by the owner.
+  alignas(kCacheLineSize) std::atomic<int64_t> bottom_;
+  std::atomic<Array *> array_;
+};
+
+// Ctors, Dtor
+
+template <typename T, typename A>
+ws_deque<T, A>::ws_deque(size_type capacity, const allocator_type &alloc)
+    : allocator_(alloc), top_(0), bottom_(0), array_(nullptr) {
+  size_type rounded = 1;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+  array_.store(create_array(rounded, nullptr), std::memory_order_relaxed);
+}
+
+/*
+ *  No thief may use the deque any more.
+ */
+template <typename T, typename A>
+ws_deque<T, A>::~ws_deque(void) {
+  CellAllocator cell_alloc(allocator_);
+  ArrayAllocator array_alloc(allocator_);
+  Array *array = array_.load(std::memory_order_relaxed);
+  while (array != nullptr) {
+    Array *previous = array->previous;
+    for (size_type i = 0; i <= array->mask; ++i) {
+      CellTraits::destroy(cell_alloc, array->cells + i);
+    }
+    CellTraits::deallocate(cell_alloc, array->cells, array->mask + 1);
+    ArrayTraits::destroy(array_alloc, array);
+    ArrayTraits::deallocate(array_alloc, array, 1);
+    array = previous;
+  }
+}
+
+template <typename T, typename A>
+inline typename ws_deque<T, A>::allocator_type ws_deque<T, A>::get_allocator(
+    void) const noexcept {
+  return allocator_;
+}
+
+// CAPACITY
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline bool ws_deque<T, A>::empty(void) const noexcept {
+  return size() == 0;
+}
+
+/*
+ *  A snapshot that may be stale by the time it is returned.
+ */
+template <typename T, typename A>
+inline typename ws_deque<T, A>::size_type ws_deque<T, A>::size(
+    void) const noexcept {
+  int64_t bottom = bottom_.load();
+  int64_t top = top_.load();
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <typename T, typename A>
+inline typename ws_deque<T, A>::size_type ws_deque<T, A>::capacity(
+    void) const noexcept {
+  return array_.load(std::memory_order_relaxed)->mask + 1;
+}
+
+// MODIFIERS
+
+/*
+ *  Push a value at the bottom, growing the array if it is full.
+ */
+template <typename T, typename A>
+void ws_deque<T, A>::push(const_reference value) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Array *array = array_.load(std::memory_order_relaxed);
+  if (static_cast<size_type>(bottom - top) > array->mask) {
+    array = grow(array, top, bottom);
+  }
+  array->store(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+/*
+ *  Take the bottom value, the one pushed last.
+ *  Returns false if the deque is empty or a thief took the last value.
+ *
+ *  bottom_ is lowered before top_ is read, and both accesses are
+ *  sequentially consistent, so a thief that reads top_ after the owner
+ *  either sees the lowered bottom or loses the compare-and-swap.
+ */
+template <typename T, typename A>
+bool ws_deque<T, A>::try_pop(reference out) noexcept {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array *array = array_.load(std::memory_order_relaxed);
+  bottom_.store(bottom);
+  int64_t top = top_.load();
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  T value = array->load(bottom);
+  if (top == bottom) {
+    // The last value: race the thieves for it.
+    bool won = top_.compare_exchange_strong(top, top + 1);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    if (!won) {
+      return false;
+    }
+  }
+  out = value;
+  return true;
+}
+
+/*
+ *  Take the top value, the oldest one. May be called by any thread.
+ *  Returns false if the deque is empty or another thread won the value.
+ */
+template <typename T, typename A>
+bool ws_deque<T, A>::try_steal(reference out) noexcept {
+  int64_t top = top_.load();
+  int64_t bottom = bottom_.load();
+  if (top >= bottom) {
+    return false;
+  }
+  Array *array = array_.load(std::memory_order_acquire);
+  T value = array->load(top);
+  if (!top_.compare_exchange_strong(top, top + 1)) {
+    return false;
+  }
+  out = value;
+  return true;
+}
+
+// Support functions
+
+template <typename T, typename A>
+typename ws_deque<T, A>::Array *ws_deque<T, A>::create_array(
+    size_type capacity, Array *previous) {
+  CellAllocator cell_alloc(allocator_);
+  ArrayAllocator array_alloc(allocator_);
+  Cell *cells = CellTraits::allocate(cell_alloc, capacity);
+  for (size_type i = 0; i < capacity; ++i) {
+    CellTraits::construct(cell_alloc, cells + i, T());
+  }
+  Array *array;
+  try {
+    array = ArrayTraits::allocate(array_alloc, 1);
+  } catch (...) {
+    CellTraits::deallocate(cell_alloc, cells, capacity);
+    throw;
+  }
+  ArrayTraits::construct(array_alloc, array,
+                         Array{cells, capacity - 1, previous});
+  return array;
+}
+
+/*
+ *  Copy the values of [top, bottom) to an array twice as large and
+ *  publish it. The old array stays readable for thieves.
+ */
+template <typename T, typename A>
+typename ws_deque<T, A>::Array *ws_deque<T, A>::grow(Array *array,
+                                                     int64_t top,
+                                                     int64_t bottom) {
+  Array *bigger = create_array((array->mask + 1) * 2, array);
+  for (int64_t i = top; i < bottom; ++i) {
+    bigger->store(i, array->load(i));
+  }
+  array_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+}  // namespace s21
+
+#endif  // INCLUDE_S21_WS_DEQUE_H_
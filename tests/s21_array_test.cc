@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <string>
 
 class ArrayTest : public ::testing::Test {
  protected:
@@ -196,3 +197,33 @@ TEST_F(ArrayTest, Fill) {
     EXPECT_EQ(s21_4[i], std_4[i]);
   }
 }
+
+TEST_F(ArrayTest, FillTrivialAndNonTrivial) {
+  s21::array<char, 33> bytes;
+  bytes.fill('z');
+  for (char c : bytes) {
+    EXPECT_EQ(c, 'z');
+  }
+
+  s21::array<long, 17> zeros;
+  zeros.fill(0);
+  s21::array<long, 17> longs;
+  longs.fill(0x0102030405060708L);
+  for (size_t i = 0; i < longs.size(); ++i) {
+    EXPECT_EQ(zeros[i], 0);
+    EXPECT_EQ(longs[i], 0x0102030405060708L);
+  }
+
+  s21::array<std::string, 4> strings;
+  strings.fill("abc");
+  s21::array<std::string, 4> copy(strings);
+  for (size_t i = 0; i < copy.size(); ++i) {
+    EXPECT_EQ(copy[i], "abc");
+  }
+
+  s21::array<long, 17> longs_copy(longs);
+  zeros = longs_copy;
+  for (size_t i = 0; i < zeros.size(); ++i) {
+    EXPECT_EQ(zeros[i], 0x0102030405060708L);
+  }
+}
@@ -0,0 +1,186 @@
+#include "s21_blocking_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_ring_buffer.h"
+
+class BlockingQueueTest : public ::testing::Test {};
+
+TEST_F(BlockingQueueTest, PushPop) {
+  s21::blocking_queue<std::string> q;
+  EXPECT_EQ(q.capacity(), 0U);
+  EXPECT_TRUE(q.empty());
+
+  std::string out;
+  EXPECT_FALSE(q.try_pop(out));
+  std::string item(100, 'a');
+  EXPECT_TRUE(q.push(std::move(item)));
+  EXPECT_TRUE(q.emplace(3, 'b'));
+  EXPECT_TRUE(q.try_push("c"));
+  EXPECT_EQ(q.size(), 3U);
+
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, std::string(100, 'a'));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "bbb");
+  EXPECT_TRUE(q.try_pop_for(out, std::chrono::milliseconds(1)));
+  EXPECT_EQ(out, "c");
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(BlockingQueueTest, Close) {
+  s21::blocking_queue<int, s21::ring_buffer<int>> q(4);
+  EXPECT_TRUE(q.push(1));
+  EXPECT_TRUE(q.push(2));
+  EXPECT_FALSE(q.closed());
+  q.close();
+  EXPECT_TRUE(q.closed());
+  EXPECT_FALSE(q.push(3));
+  EXPECT_FALSE(q.try_push(3));
+
+  int out = 0;
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, 1);
+  std::vector<int> batch;
+  EXPECT_EQ(q.pop_batch(std::back_inserter(batch), 8), 1U);
+  EXPECT_EQ(batch, std::vector<int>({2}));
+  EXPECT_FALSE(q.pop(out));
+  EXPECT_FALSE(q.try_pop_for(out, std::chrono::seconds(10)));
+  EXPECT_EQ(q.pop_batch(std::back_inserter(batch), 8), 0U);
+}
+
+TEST_F(BlockingQueueTest, CloseWakesWaiters) {
+  s21::blocking_queue<int> empty;
+  s21::blocking_queue<int> full(1);
+  full.push(1);
+  std::atomic<int> woken(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 2; ++i) {
+    threads.emplace_back([&] {
+      int out;
+      woken += empty.pop(out) ? 0 : 1;
+    });
+    threads.emplace_back([&] { woken += full.push(2) ? 0 : 1; });
+  }
+  empty.close();
+  full.close();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(woken, 4);
+}
+
+TEST_F(BlockingQueueTest, TimedPop) {
+  s21::blocking_queue<int> q;
+  int out = 0;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(q.try_pop_for(out, std::chrono::milliseconds(20)));
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+
+  std::thread producer([&q] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    q.push(7);
+  });
+  EXPECT_TRUE(q.try_pop_for(out, std::chrono::seconds(10)));
+  EXPECT_EQ(out, 7);
+  producer.join();
+}
+
+TEST_F(BlockingQueueTest, PopBatch) {
+  s21::blocking_queue<int> q;
+  for (int i = 0; i < 10; ++i) {
+    q.push(i);
+  }
+  int batch[4] = {};
+  EXPECT_EQ(q.pop_batch(batch, 0), 0U);
+  EXPECT_EQ(q.pop_batch(batch, 4), 4U);
+  EXPECT_EQ(batch[0], 0);
+  EXPECT_EQ(batch[3], 3);
+
+  std::vector<int> rest;
+  EXPECT_EQ(q.pop_batch(std::back_inserter(rest), 100), 6U);
+  EXPECT_EQ(rest, std::vector<int>({4, 5, 6, 7, 8, 9}));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(BlockingQueueTest, Backpressure) {
+  s21::blocking_queue<int> q(2);
+  EXPECT_TRUE(q.push(0));
+  EXPECT_TRUE(q.push(1));
+  EXPECT_FALSE(q.try_push(2));
+
+  std::atomic<bool> pushed(false);
+  std::thread producer([&] {
+    q.push(2);
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(pushed);
+  EXPECT_EQ(q.size(), 2U);
+  int out;
+  EXPECT_TRUE(q.pop(out));
+  producer.join();
+  EXPECT_TRUE(pushed);
+  EXPECT_EQ(q.size(), 2U);
+}
+
+TEST_F(BlockingQueueTest, Stress) {
+  constexpr int kThreads = 4;
+  constexpr int64_t kPerThread = 1 << 14;
+  s21::blocking_queue<int64_t> q(16);
+  std::vector<std::thread> producers;
+  std::vector<std::thread> consumers;
+  std::vector<int64_t> sums(kThreads, 0);
+  std::vector<int64_t> counts(kThreads, 0);
+  for (int p = 0; p < kThreads; ++p) {
+    producers.emplace_back([p, &q] {
+      for (int64_t i = 0; i < kPerThread; ++i) {
+        q.push(p * kPerThread + i);
+      }
+    });
+  }
+  for (int c = 0; c < kThreads; ++c) {
+    consumers.emplace_back([c, &q, &sums, &counts] {
+      int64_t batch[8];
+      if (c % 2 == 0) {
+        for (int64_t value; q.pop(value);) {
+          sums[c] += value;
+          ++counts[c];
+        }
+      } else {
+        for (size_t n; (n = q.pop_batch(batch, 8)) != 0;) {
+          for (size_t i = 0; i < n; ++i) {
+            sums[c] += batch[i];
+          }
+          counts[c] += n;
+        }
+      }
+    });
+  }
+  for (std::thread &thread : producers) {
+    thread.join();
+  }
+  q.close();
+  for (std::thread &thread : consumers) {
+    thread.join();
+  }
+  int64_t total = 0;
+  int64_t received = 0;
+  for (int c = 0; c < kThreads; ++c) {
+    total += sums[c];
+    received += counts[c];
+  }
+  int64_t count = kThreads * kPerThread;
+  EXPECT_EQ(received, count);
+  EXPECT_EQ(total, count * (count - 1) / 2);
+}
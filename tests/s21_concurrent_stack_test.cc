@@ -0,0 +1,134 @@
+#include "s21_concurrent_stack.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class ConcurrentStackTest : public ::testing::Test {
+ public:
+  class Thrower {
+   public:
+    static int count;
+
+    Thrower(int value) : value_(value) {
+      if (++count == 3) {
+        throw std::runtime_error("Thrower");
+      }
+    }
+    Thrower(const Thrower &other) : Thrower(other.value_) {}
+    Thrower &operator=(Thrower &&other) noexcept = default;
+    int value(void) const { return value_; }
+
+   private:
+    int value_;
+  };
+};
+
+int ConcurrentStackTest::Thrower::count = 0;
+
+TEST_F(ConcurrentStackTest, PushPop) {
+  s21::concurrent_stack<std::string> stack;
+  EXPECT_TRUE(stack.empty());
+  std::string out;
+  EXPECT_FALSE(stack.try_pop(out));
+
+  stack.push("a");
+  std::string b(100, 'b');
+  stack.push(b);
+  stack.emplace(3, 'c');
+  EXPECT_FALSE(stack.empty());
+  EXPECT_TRUE(stack.try_pop(out));
+  EXPECT_EQ(out, "ccc");
+  EXPECT_TRUE(stack.try_pop(out));
+  EXPECT_EQ(out, b);
+  EXPECT_TRUE(stack.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(ConcurrentStackTest, PushChain) {
+  s21::concurrent_stack<int> stack;
+  stack.push(0);
+  std::vector<int> chain = {1, 2, 3, 4};
+  stack.push_chain(chain.begin(), chain.end());
+  stack.push_chain(chain.end(), chain.end());
+  for (int expected = 4; expected >= 0; --expected) {
+    int out = -1;
+    ASSERT_TRUE(stack.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_TRUE(stack.empty());
+
+  Thrower::count = 0;
+  s21::concurrent_stack<Thrower> throwers;
+  std::vector<int> values = {1, 2, 3};
+  EXPECT_THROW(throwers.push_chain(values.begin(), values.end()),
+               std::runtime_error);
+  EXPECT_TRUE(throwers.empty());
+}
+
+TEST_F(ConcurrentStackTest, ReclaimsNodes) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::concurrent_stack<std::string, Alloc> stack{Alloc(&stats)};
+    std::string out;
+    for (int i = 0; i < 100000; ++i) {
+      stack.push(std::string(100, 'a'));
+      ASSERT_TRUE(stack.try_pop(out));
+    }
+    EXPECT_LT(stats.allocations - stats.deallocations, 1000U);
+    stack.push("left");
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(ConcurrentStackTest, StressFreeList) {
+  constexpr int kThreads = 32;
+  constexpr int kBuffers = 256;
+  constexpr int kRounds = 4000;
+  s21::concurrent_stack<std::unique_ptr<int>> free_list;
+  for (int i = 0; i < kBuffers; ++i) {
+    free_list.push(std::make_unique<int>(i));
+  }
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&free_list, t] {
+      std::vector<std::unique_ptr<int>> taken(4);
+      for (int round = 0; round < kRounds; ++round) {
+        size_t want = 1 + (round + t) % 4;
+        size_t n = 0;
+        while (n < want && free_list.try_pop(taken[n])) {
+          *taken[n++] += 1;
+        }
+        if (n == 1) {
+          free_list.push(std::move(taken[0]));
+        } else {
+          free_list.push_chain(std::make_move_iterator(taken.begin()),
+                               std::make_move_iterator(taken.begin() + n));
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  std::set<int *> buffers;
+  std::unique_ptr<int> buffer;
+  while (free_list.try_pop(buffer)) {
+    buffers.insert(buffer.release());
+  }
+  EXPECT_EQ(buffers.size(), static_cast<size_t>(kBuffers));
+  for (int *ptr : buffers) {
+    delete ptr;
+  }
+}
@@ -0,0 +1,232 @@
+#include "s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "s21_test_allocator.h"
+
+class DequeTest : public ::testing::Test {
+ protected:
+  void SetUp(void) override { std::srand(1); }
+
+  template <typename T, typename A>
+  bool DequeEqual(const s21::deque<T, A> &lhs, const std::deque<T> &rhs) {
+    return lhs.empty() == rhs.empty() && lhs.size() == rhs.size() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+ public:
+  class Thrower {
+   public:
+    static int count;
+
+    explicit Thrower(int value) : value_(value) {
+      if (++count == 3) {
+        throw std::runtime_error("Thrower");
+      }
+    }
+    int value(void) const { return value_; }
+
+   private:
+    int value_;
+  };
+};
+
+int DequeTest::Thrower::count = 0;
+
+TEST_F(DequeTest, Constructors) {
+  s21::deque<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.size(), 0U);
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::deque<int> sized(5000);
+  EXPECT_TRUE(DequeEqual(sized, std::deque<int>(5000)));
+
+  s21::deque<std::string> items = {"a", "b", "c"};
+  EXPECT_TRUE(DequeEqual(items, std::deque<std::string>{"a", "b", "c"}));
+
+  s21::deque<std::string> copy(items);
+  EXPECT_TRUE(DequeEqual(copy, std::deque<std::string>{"a", "b", "c"}));
+
+  s21::deque<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_TRUE(DequeEqual(moved, std::deque<std::string>{"a", "b", "c"}));
+}
+
+TEST_F(DequeTest, Assignment) {
+  s21::deque<std::string> a = {"1", "2", "3"};
+  s21::deque<std::string> b;
+  b = a;
+  EXPECT_TRUE(DequeEqual(b, std::deque<std::string>{"1", "2", "3"}));
+  a = s21::deque<std::string>(2000);
+  EXPECT_TRUE(DequeEqual(a, std::deque<std::string>(2000)));
+  a = std::move(b);
+  EXPECT_TRUE(DequeEqual(a, std::deque<std::string>{"1", "2", "3"}));
+  a = a;
+  EXPECT_EQ(a.size(), 3U);
+}
+
+TEST_F(DequeTest, PushPopBothEnds) {
+  s21::deque<int> s21_deq;
+  std::deque<int> std_deq;
+  for (int i = 0; i < 100000; ++i) {
+    int value = std::rand();
+    switch (value % 5) {
+      case 0:
+      case 1:
+        s21_deq.push_back(value);
+        std_deq.push_back(value);
+        break;
+      case 2:
+        s21_deq.push_front(value);
+        std_deq.push_front(value);
+        break;
+      case 3:
+        if (!std_deq.empty()) {
+          s21_deq.pop_back();
+          std_deq.pop_back();
+        }
+        break;
+      default:
+        if (!std_deq.empty()) {
+          s21_deq.pop_front();
+          std_deq.pop_front();
+        }
+    }
+    ASSERT_EQ(s21_deq.size(), std_deq.size());
+    if (!std_deq.empty()) {
+      ASSERT_EQ(s21_deq.front(), std_deq.front());
+      ASSERT_EQ(s21_deq.back(), std_deq.back());
+    }
+  }
+  EXPECT_TRUE(DequeEqual(s21_deq, std_deq));
+}
+
+TEST_F(DequeTest, Access) {
+  s21::deque<int> deq;
+  for (int i = 0; i < 3000; ++i) {
+    deq.push_front(-i);
+    deq.push_back(i);
+  }
+  const s21::deque<int> &cdeq = deq;
+  EXPECT_EQ(deq.front(), -2999);
+  EXPECT_EQ(cdeq.back(), 2999);
+  EXPECT_EQ(deq[2999], 0);
+  EXPECT_EQ(cdeq.at(3000), 0);
+  EXPECT_EQ(deq.at(5999), 2999);
+  EXPECT_THROW(deq.at(6000), std::out_of_range);
+  EXPECT_THROW(cdeq.at(6000), std::out_of_range);
+  deq[0] = 7;
+  EXPECT_EQ(cdeq.front(), 7);
+  EXPECT_GE(deq.max_size(), deq.size());
+}
+
+TEST_F(DequeTest, Iterators) {
+  s21::deque<int> deq;
+  for (int i = 0; i < 5000; ++i) {
+    deq.push_front(i);
+  }
+  std::sort(deq.begin(), deq.end());
+  s21::deque<int>::const_iterator it = deq.begin();
+  EXPECT_EQ(*it, 0);
+  EXPECT_EQ(it[4999], 4999);
+  EXPECT_EQ(deq.end() - it, 5000);
+  EXPECT_EQ(*(deq.end() - 1), 4999);
+  EXPECT_TRUE(it < deq.end());
+  EXPECT_EQ(std::distance(deq.begin(), deq.end()), 5000);
+  EXPECT_TRUE(std::is_sorted(deq.begin(), deq.end()));
+  it += 10;
+  EXPECT_EQ(*it--, 10);
+  EXPECT_EQ(*it, 9);
+}
+
+TEST_F(DequeTest, InsertMany) {
+  s21::deque<std::string> deq = {"c"};
+  deq.insert_many_back("d", std::string("e"));
+  deq.insert_many_front("a", "b");
+  deq.insert_many_front();
+  deq.insert_many_back();
+  EXPECT_TRUE(
+      DequeEqual(deq, std::deque<std::string>{"a", "b", "c", "d", "e"}));
+
+  Thrower::count = 0;
+  s21::deque<Thrower> throwers;
+  throwers.emplace_back(1);
+  EXPECT_THROW(throwers.insert_many_front(2, 3), std::runtime_error);
+  EXPECT_EQ(throwers.size(), 1U);
+  EXPECT_EQ(throwers.front().value(), 1);
+}
+
+TEST_F(DequeTest, Swap) {
+  s21::deque<std::string> a = {"1", "2"};
+  s21::deque<std::string> b(3000);
+  a.swap(b);
+  EXPECT_TRUE(DequeEqual(a, std::deque<std::string>(3000)));
+  EXPECT_TRUE(DequeEqual(b, std::deque<std::string>{"1", "2"}));
+}
+
+TEST_F(DequeTest, ReusesBlocks) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::deque<int, Alloc> deq{Alloc(&stats)};
+    for (int i = 0; i < 10000; ++i) {
+      deq.push_back(i);
+    }
+    for (int i = 10000; i < 100000; ++i) {
+      deq.pop_front();
+      deq.push_back(i);
+    }
+    size_t allocations = stats.allocations;
+    for (int i = 100000; i < 1000000; ++i) {
+      deq.pop_front();
+      deq.push_back(i);
+    }
+    EXPECT_EQ(stats.allocations, allocations);
+    EXPECT_EQ(deq.front(), 990000);
+    EXPECT_EQ(deq.back(), 999999);
+
+    while (deq.size() > 1) {
+      deq.pop_back();
+    }
+    deq.shrink_to_fit();
+    EXPECT_LT(stats.live_bytes, 3 * s21::DequeBlockSize<int>() * sizeof(int));
+    deq.clear();
+    deq.shrink_to_fit();
+    deq.push_front(1);
+    deq.push_back(2);
+    EXPECT_EQ(deq.front() + deq.back(), 3);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(DequeTest, StatefulAllocator) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  s21_test::AllocatorStats other_stats;
+  {
+    s21::deque<std::string, Alloc> deq{Alloc(&stats)};
+    deq.insert_many_back("a", "b", "c");
+    s21::deque<std::string, Alloc> copy(deq);
+    EXPECT_EQ(copy.get_allocator(), Alloc(&stats));
+
+    s21::deque<std::string, Alloc> other{Alloc(&other_stats)};
+    other = std::move(deq);
+    EXPECT_EQ(other.get_allocator(), Alloc(&other_stats));
+    EXPECT_EQ(other.size(), 3U);
+    EXPECT_TRUE(deq.empty());
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(other_stats.allocations, other_stats.deallocations);
+  EXPECT_EQ(stats.live_bytes + other_stats.live_bytes, 0U);
+}
@@ -0,0 +1,111 @@
+#include "s21_epoch.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class EpochTest : public ::testing::Test {
+ public:
+  struct Node : s21::epoch_hook {
+    explicit Node(int64_t value) : value(value), check(~value) {}
+    ~Node(void) { check = value; }
+
+    int64_t value;
+    int64_t check;
+  };
+};
+
+TEST_F(EpochTest, ReclaimsInBatches) {
+  using Alloc = s21_test::CountingAllocator<Node>;
+  using Domain = s21::epoch_domain<Node, Alloc>;
+  s21_test::AllocatorStats stats;
+  {
+    Alloc alloc(&stats);
+    Domain domain(alloc);
+    for (int i = 0; i < 100000; ++i) {
+      Node *node = alloc.allocate(1);
+      ::new (static_cast<void *>(node)) Node(i);
+      Domain::guard guard(domain);
+      guard.retire(node);
+    }
+    EXPECT_GT(stats.deallocations, 0U);
+    EXPECT_LT(stats.allocations - stats.deallocations,
+              4 * Domain::kAdvancePeriod);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(EpochTest, GuardDelaysReclamation) {
+  using Alloc = s21_test::CountingAllocator<Node>;
+  using Domain = s21::epoch_domain<Node, Alloc>;
+  s21_test::AllocatorStats stats;
+  Alloc alloc(&stats);
+  Domain domain(alloc);
+  auto retire_many = [&alloc, &domain] {
+    for (int i = 0; i < 1000; ++i) {
+      Node *node = alloc.allocate(1);
+      ::new (static_cast<void *>(node)) Node(i);
+      Domain::guard guard(domain);
+      guard.retire(node);
+    }
+  };
+  {
+    Domain::guard reader(domain);
+    retire_many();
+    EXPECT_EQ(stats.deallocations, 0U);
+  }
+  retire_many();
+  EXPECT_GT(stats.deallocations, 0U);
+}
+
+TEST_F(EpochTest, StressReaders) {
+  using Domain = s21::epoch_domain<Node>;
+  constexpr int kReaders = 12;
+  constexpr int kWriters = 4;
+  constexpr int kUpdates = 20000;
+  Domain domain;
+  std::atomic<Node *> current(new Node(0));
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+  std::vector<std::thread> threads;
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&] {
+      while (!done.load()) {
+        Domain::guard guard(domain);
+        Node *node = current.load(std::memory_order_acquire);
+        for (int i = 0; i < 8; ++i) {
+          if (node->check != ~node->value) {
+            ++torn;
+          }
+        }
+      }
+    });
+  }
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&, w] {
+      std::allocator<Node> alloc;
+      for (int i = 0; i < kUpdates; ++i) {
+        Node *node = alloc.allocate(1);
+        ::new (static_cast<void *>(node)) Node(w * kUpdates + i);
+        Domain::guard guard(domain);
+        guard.retire(current.exchange(node, std::memory_order_acq_rel));
+      }
+    });
+  }
+  for (int t = kReaders; t < kReaders + kWriters; ++t) {
+    threads[t].join();
+  }
+  done.store(true);
+  for (int t = 0; t < kReaders; ++t) {
+    threads[t].join();
+  }
+  EXPECT_EQ(torn.load(), 0);
+  delete current.load();
+}
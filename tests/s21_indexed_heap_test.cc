@@ -0,0 +1,184 @@
+#include "s21_indexed_heap.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+class IndexedHeapTest : public ::testing::Test {
+ protected:
+  void SetUp(void) override { srand(1); }
+
+  // A key that can be copied but throws when a negative value is moved.
+  struct FragileKey {
+    explicit FragileKey(int value) : value(value) {}
+    FragileKey(const FragileKey &other) = default;
+    FragileKey(FragileKey &&other) : value(other.value) { Check(); }
+    FragileKey &operator=(const FragileKey &other) = default;
+    FragileKey &operator=(FragileKey &&other) {
+      value = other.value;
+      Check();
+      return *this;
+    }
+
+    void Check(void) const {
+      if (value < 0) {
+        throw std::runtime_error("key");
+      }
+    }
+
+    int value;
+  };
+};
+
+TEST_F(IndexedHeapTest, PushPop) {
+  s21::indexed_heap<std::string, int> heap;
+  EXPECT_TRUE(heap.empty());
+  auto c = heap.push("c", 30);
+  auto a = heap.push("a", 10);
+  auto b = heap.push("b", 20);
+  EXPECT_EQ(heap.size(), 3U);
+  EXPECT_EQ(heap.top(), a);
+  EXPECT_EQ(heap.top_key(), "a");
+  EXPECT_EQ(heap.top_priority(), 10);
+  EXPECT_EQ(heap.key(b), "b");
+  EXPECT_EQ(heap.priority(c), 30);
+
+  heap.pop();
+  EXPECT_FALSE(heap.contains(a));
+  EXPECT_TRUE(heap.contains(b));
+  EXPECT_EQ(heap.top_key(), "b");
+  auto d = heap.push("d", 5);
+  EXPECT_EQ(d, a);
+  EXPECT_EQ(heap.top_key(), "d");
+  EXPECT_TRUE(heap.verify());
+
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  EXPECT_FALSE(heap.contains(b));
+}
+
+TEST_F(IndexedHeapTest, ChangeKeys) {
+  s21::indexed_heap<int, int, s21::Less<int>, 4> heap;
+  std::vector<size_t> handles;
+  for (int i = 0; i < 20; ++i) {
+    handles.push_back(heap.push(i, 100 + i));
+  }
+  heap.decrease_key(handles[15], 1);
+  EXPECT_EQ(heap.top_key(), 15);
+  heap.increase_key(handles[15], 200);
+  EXPECT_EQ(heap.top_key(), 0);
+  heap.update(handles[7], 50);
+  EXPECT_EQ(heap.top_key(), 7);
+  heap.update(handles[7], 300);
+  heap.erase(handles[0]);
+  EXPECT_FALSE(heap.contains(handles[0]));
+  EXPECT_EQ(heap.top_key(), 1);
+  EXPECT_EQ(heap.size(), 19U);
+  EXPECT_TRUE(heap.verify());
+
+  std::vector<int> order;
+  for (; !heap.empty(); heap.pop()) {
+    order.push_back(heap.top_key());
+  }
+  std::vector<int> expected = {1, 2, 3, 4, 5, 6, 8, 9, 10, 11,
+                               12, 13, 14, 16, 17, 18, 19, 15, 7};
+  EXPECT_EQ(order, expected);
+}
+
+TEST_F(IndexedHeapTest, PushThrows) {
+  s21::indexed_heap<FragileKey, int> heap;
+  FragileKey bad(-1);
+  auto a = heap.push(FragileKey(1), 10);
+  EXPECT_THROW(heap.push(bad, 5), std::runtime_error);
+  EXPECT_EQ(heap.size(), 1U);
+  EXPECT_EQ(heap.top(), a);
+  EXPECT_TRUE(heap.verify());
+  auto b = heap.push(FragileKey(2), 20);
+  EXPECT_EQ(b, a + 1);
+
+  heap.erase(a);
+  EXPECT_THROW(heap.push(bad, 5), std::runtime_error);
+  EXPECT_EQ(heap.size(), 1U);
+  EXPECT_EQ(heap.top(), b);
+  EXPECT_TRUE(heap.verify());
+  EXPECT_EQ(heap.push(FragileKey(3), 30), a);
+  EXPECT_EQ(heap.key(a).value, 3);
+  EXPECT_TRUE(heap.verify());
+}
+
+TEST_F(IndexedHeapTest, RandomOperations) {
+  s21::indexed_heap<int, int, std::greater<int>, 3> heap;
+  std::map<size_t, int> model;
+  for (int step = 0; step < 5000; ++step) {
+    int op = rand() % 5;
+    if (op < 2 || model.empty()) {
+      int priority = rand() % 1000;
+      model[heap.push(step, priority)] = priority;
+    } else {
+      auto it = model.begin();
+      std::advance(it, rand() % model.size());
+      int priority = rand() % 1000;
+      if (op == 2) {
+        heap.erase(it->first);
+        model.erase(it);
+      } else if (op == 3) {
+        heap.update(it->first, priority);
+        it->second = priority;
+      } else {
+        int top = std::numeric_limits<int>::min();
+        for (const auto &entry : model) {
+          top = std::max(top, entry.second);
+        }
+        ASSERT_EQ(heap.top_priority(), top);
+        model.erase(heap.top());
+        heap.pop();
+      }
+    }
+    ASSERT_EQ(heap.size(), model.size());
+    ASSERT_TRUE(heap.verify());
+  }
+  for (const auto &entry : model) {
+    ASSERT_TRUE(heap.contains(entry.first));
+    EXPECT_EQ(heap.priority(entry.first), entry.second);
+  }
+}
+
+TEST_F(IndexedHeapTest, Dijkstra) {
+  struct Edge {
+    int to;
+    int weight;
+  };
+  std::vector<std::vector<Edge>> graph = {
+      {{1, 7}, {2, 9}, {5, 14}}, {{0, 7}, {2, 10}, {3, 15}},
+      {{0, 9}, {1, 10}, {3, 11}, {5, 2}}, {{1, 15}, {2, 11}, {4, 6}},
+      {{3, 6}, {5, 9}}, {{0, 14}, {2, 2}, {4, 9}}};
+  const int kInf = std::numeric_limits<int>::max();
+  std::vector<int> dist(graph.size(), kInf);
+  std::vector<size_t> handle(graph.size());
+  s21::indexed_heap<int, int> heap;
+  dist[0] = 0;
+  for (size_t v = 0; v < graph.size(); ++v) {
+    handle[v] = heap.push(v, dist[v]);
+  }
+  while (!heap.empty()) {
+    int u = heap.top_key();
+    heap.pop();
+    for (const Edge &edge : graph[u]) {
+      int d = dist[u] + edge.weight;
+      if (heap.contains(handle[edge.to]) && d < dist[edge.to]) {
+        dist[edge.to] = d;
+        heap.decrease_key(handle[edge.to], d);
+      }
+    }
+  }
+  EXPECT_EQ(dist, std::vector<int>({0, 7, 9, 20, 20, 11}));
+}
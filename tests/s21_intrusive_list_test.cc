@@ -0,0 +1,191 @@
+#include "s21_intrusive_list.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class IntrusiveListTest : public ::testing::Test {
+ protected:
+  struct Timer {
+    explicit Timer(int deadline) : deadline(deadline) {}
+
+    bool operator<(const Timer &other) const {
+      return deadline < other.deadline;
+    }
+
+    int deadline;
+    s21::list_hook hook;
+    s21::list_hook expired_hook;
+  };
+
+  using TimerList = s21::intrusive_list<Timer, &Timer::hook>;
+
+  static std::vector<int> Deadlines(const TimerList &timers) {
+    std::vector<int> result;
+    for (const Timer &timer : timers) {
+      result.push_back(timer.deadline);
+    }
+    std::vector<int> backwards;
+    for (auto it = timers.end(); it != timers.begin();) {
+      backwards.insert(backwards.begin(), (--it)->deadline);
+    }
+    EXPECT_EQ(result, backwards);
+    EXPECT_EQ(result.size(), timers.size());
+    return result;
+  }
+
+  void SetUp(void) override {
+    for (int i = 0; i < 8; ++i) {
+      pool.emplace_back(i);
+    }
+  }
+
+  std::list<Timer> pool;
+};
+
+TEST_F(IntrusiveListTest, LinkUnlink) {
+  TimerList timers;
+  EXPECT_TRUE(timers.empty());
+  for (Timer &timer : pool) {
+    EXPECT_FALSE(timer.hook.is_linked());
+    timers.push_back(timer);
+  }
+  Timer &first = pool.front();
+  Timer &last = pool.back();
+  EXPECT_EQ(&timers.front(), &first);
+  EXPECT_EQ(&timers.back(), &last);
+  EXPECT_TRUE(first.hook.is_linked());
+  EXPECT_FALSE(first.expired_hook.is_linked());
+
+  timers.pop_front();
+  timers.pop_back();
+  EXPECT_FALSE(first.hook.is_linked());
+  timers.push_front(last);
+  EXPECT_EQ(Deadlines(timers), (std::vector<int>{7, 1, 2, 3, 4, 5, 6}));
+
+  Timer &third = *std::next(pool.begin(), 3);
+  timers.erase(third);
+  EXPECT_FALSE(third.hook.is_linked());
+  auto it = timers.iterator_to(*std::next(pool.begin(), 5));
+  it = timers.erase(it);
+  EXPECT_EQ(it->deadline, 6);
+  timers.insert(it, third);
+  EXPECT_EQ(Deadlines(timers), (std::vector<int>{7, 1, 2, 4, 3, 6}));
+
+  // A copy of a linked object is not linked.
+  Timer copy(third);
+  EXPECT_FALSE(copy.hook.is_linked());
+  copy = first;
+  EXPECT_FALSE(copy.hook.is_linked());
+
+  EXPECT_EQ(timers.remove_if([](const Timer &t) { return t.deadline < 3; }),
+            2U);
+  EXPECT_EQ(Deadlines(timers), (std::vector<int>{7, 4, 3, 6}));
+  timers.clear();
+  for (Timer &timer : pool) {
+    EXPECT_FALSE(timer.hook.is_linked());
+  }
+}
+
+TEST_F(IntrusiveListTest, TwoHooks) {
+  TimerList timers;
+  s21::intrusive_list<Timer, &Timer::expired_hook> expired;
+  for (Timer &timer : pool) {
+    timers.push_back(timer);
+    if (timer.deadline % 2 == 0) {
+      expired.push_front(timer);
+    }
+  }
+  EXPECT_EQ(expired.size(), 4U);
+  EXPECT_EQ(expired.front().deadline, 6);
+  for (Timer &timer : expired) {
+    timers.erase(timer);
+  }
+  EXPECT_EQ(Deadlines(timers), (std::vector<int>{1, 3, 5, 7}));
+  {
+    s21::intrusive_list<Timer, &Timer::expired_hook> moved(
+        std::move(expired));
+    EXPECT_TRUE(expired.empty());
+    EXPECT_EQ(moved.back().deadline, 0);
+  }
+  EXPECT_FALSE(pool.front().expired_hook.is_linked());
+}
+
+TEST_F(IntrusiveListTest, SpliceMergeReverse) {
+  TimerList odd;
+  TimerList even;
+  for (Timer &timer : pool) {
+    (timer.deadline % 2 == 0 ? even : odd).push_back(timer);
+  }
+  odd.merge(even);
+  EXPECT_TRUE(even.empty());
+  EXPECT_EQ(Deadlines(odd), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+
+  odd.reverse();
+  even.splice(even.cend(), odd, odd.begin(), std::next(odd.begin(), 3), 3);
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{7, 6, 5}));
+  even.splice(even.cend(), odd, --odd.cend());
+  even.splice(even.cbegin(), even, --even.cend());
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{0, 7, 6, 5}));
+  even.splice(even.cend(), even, even.cbegin());
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{7, 6, 5, 0}));
+  EXPECT_EQ(Deadlines(odd), (std::vector<int>{4, 3, 2, 1}));
+
+  odd.merge(even, [](const Timer &lhs, const Timer &rhs) {
+    return lhs.deadline > rhs.deadline;
+  });
+  EXPECT_EQ(Deadlines(odd), (std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0}));
+  even.splice(even.cend(), odd, std::next(odd.cbegin(), 6), odd.cend());
+  even.splice(even.cbegin(), odd);
+  EXPECT_TRUE(odd.empty());
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0}));
+
+  odd.swap(even);
+  EXPECT_TRUE(even.empty());
+  even = std::move(odd);
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0}));
+  EXPECT_EQ(Deadlines(odd), std::vector<int>{});
+}
+
+TEST_F(IntrusiveListTest, MergeThrows) {
+  TimerList odd;
+  TimerList even;
+  for (Timer &timer : pool) {
+    (timer.deadline % 2 == 0 ? even : odd).push_back(timer);
+  }
+  int calls = 0;
+  EXPECT_THROW(odd.merge(even,
+                         [&calls](const Timer &lhs, const Timer &rhs) {
+                           if (++calls == 5) {
+                             throw std::runtime_error("compare");
+                           }
+                           return lhs < rhs;
+                         }),
+               std::runtime_error);
+  EXPECT_EQ(Deadlines(odd), (std::vector<int>{0, 1, 2, 3, 5, 7}));
+  EXPECT_EQ(Deadlines(even), (std::vector<int>{4, 6}));
+  odd.merge(even);
+  EXPECT_TRUE(even.empty());
+  EXPECT_EQ(Deadlines(odd), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST_F(IntrusiveListTest, RemoveIfThrows) {
+  TimerList timers;
+  for (Timer &timer : pool) {
+    timers.push_back(timer);
+  }
+  int calls = 0;
+  auto even = [&calls](const Timer &timer) {
+    if (++calls == 4) {
+      throw std::runtime_error("predicate");
+    }
+    return timer.deadline % 2 == 0;
+  };
+  EXPECT_THROW(timers.remove_if(even), std::runtime_error);
+  EXPECT_EQ(Deadlines(timers), (std::vector<int>{1, 3, 4, 5, 6, 7}));
+  EXPECT_FALSE(pool.front().hook.is_linked());
+}
@@ -1,10 +1,17 @@
 #include "s21_list.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "s21_test_allocator.h"
 
 class ListTest : public ::testing::Test {
  protected:
@@ -22,8 +29,8 @@ class ListTest : public ::testing::Test {
     ss.push_back(v1);
     ss.push_back(v2);
   }
-  template <typename T>
-  void EqualList(const s21::list<T> &lhs, const std::list<T> &rhs) {
+  template <typename T, typename Alloc>
+  void EqualList(const s21::list<T, Alloc> &lhs, const std::list<T> &rhs) {
     EXPECT_EQ(lhs.size(), rhs.size());
 
     auto lhs_it = lhs.begin();
@@ -614,6 +621,190 @@ TEST_F(ListTest, Splice) {
   EqualList(ll, ss);
 }
 
+TEST_F(ListTest, SpliceRange) {
+  s21::list<int> l = {1, 2, 3, 4, 5, 6};
+  std::list<int> s = {1, 2, 3, 4, 5, 6};
+  s21::list<int> ll = {10, 20, 30, 40};
+  std::list<int> ss = {10, 20, 30, 40};
+
+  l.splice(l.cbegin(), ll, ++ll.cbegin());
+  s.splice(s.cbegin(), ss, ++ss.cbegin());
+  EqualList(l, s);
+  EqualList(ll, ss);
+
+  l.splice(l.cend(), ll, ll.cbegin(), ll.cend(), ll.size());
+  s.splice(s.cend(), ss, ss.cbegin(), ss.cend());
+  EqualList(l, s);
+  EqualList(ll, ss);
+
+  auto lfirst = l.cbegin();
+  auto sfirst = s.cbegin();
+  std::advance(lfirst, 2);
+  std::advance(sfirst, 2);
+  ll.splice(ll.cend(), l, lfirst, l.cend());
+  ss.splice(ss.cend(), s, sfirst, s.cend());
+  EqualList(l, s);
+  EqualList(ll, ss);
+
+  ll.splice(ll.cbegin(), ll, --ll.cend(), ll.cend());
+  ss.splice(ss.cbegin(), ss, --ss.cend(), ss.cend());
+  l.splice(l.cbegin(), ll, ll.cbegin(), ll.cbegin(), 0);
+  EqualList(l, s);
+  EqualList(ll, ss);
+
+  s21::list<int> empty;
+  l.splice(l.cbegin(), empty);
+  l.merge(empty);
+  EqualList(l, s);
+
+  ll.reserve_nodes(8);
+  l.splice(l.cend(), ll, ++ll.cbegin(), ll.cend(), ll.size() - 1);
+  s.splice(s.cend(), ss, ++ss.cbegin(), ss.cend());
+  EqualList(l, s);
+  EqualList(ll, ss);
+}
+
+TEST_F(ListTest, SortCompare) {
+  struct Item {
+    int key;
+    int order;
+    bool operator==(const Item &other) const {
+      return key == other.key && order == other.order;
+    }
+  };
+  auto by_key = [](const Item &lhs, const Item &rhs) {
+    return lhs.key > rhs.key;
+  };
+  for (int n : {100, 20000}) {
+    s21::list<Item> l;
+    std::list<Item> s;
+    for (int i = 0; i < n; ++i) {
+      Item item{std::rand() % 50, i};
+      l.push_back(item);
+      s.push_back(item);
+    }
+    l.sort(by_key);
+    s.sort(by_key);
+    EqualList(l, s);
+  }
+
+  // Values that are not cached in the buffer.
+  s21::list<std::pair<int, int>> pairs;
+  for (size_t i = 0; i <= pairs.kSortBufferMin; ++i) {
+    pairs.emplace_back(std::rand() % 1000, i);
+  }
+  pairs.sort([](const std::pair<int, int> &lhs,
+                const std::pair<int, int> &rhs) {
+    return lhs.first < rhs.first;
+  });
+  EXPECT_EQ(pairs.size(), pairs.kSortBufferMin + 1);
+  auto prev = pairs.cbegin();
+  for (auto it = ++pairs.cbegin(); it != pairs.cend(); prev = it++) {
+    ASSERT_TRUE(*prev < *it);
+  }
+}
+
+TEST_F(ListTest, SortThrows) {
+  for (int n : {100, 3000}) {
+    for (int fail_at : {1, 50, 4 * n}) {
+      s21::list<int> l;
+      std::vector<int> values;
+      for (int i = 0; i < n; ++i) {
+        values.push_back(std::rand() % 1000);
+        l.push_back(values.back());
+      }
+      int calls = 0;
+      EXPECT_THROW(l.sort([&calls, fail_at](int lhs, int rhs) {
+        if (++calls == fail_at) {
+          throw std::runtime_error("compare");
+        }
+        return lhs < rhs;
+      }),
+                   std::runtime_error);
+      // Every element is still in the list, in some order.
+      EXPECT_EQ(l.size(), values.size());
+      std::vector<int> kept(l.begin(), l.end());
+      std::vector<int> backwards;
+      for (auto it = l.end(); it != l.begin();) {
+        backwards.insert(backwards.begin(), *--it);
+      }
+      EXPECT_EQ(kept, backwards);
+      if (static_cast<size_t>(n) >= l.kSortBufferMin) {
+        // The buffer sort relinks only at the end.
+        EXPECT_EQ(kept, values);
+      }
+      std::sort(kept.begin(), kept.end());
+      std::sort(values.begin(), values.end());
+      EXPECT_EQ(kept, values);
+      l.sort();
+      EqualList(l, std::list<int>(values.begin(), values.end()));
+    }
+  }
+}
+
+TEST_F(ListTest, MergeThrows) {
+  s21::list<int> l = {1, 3, 5, 7};
+  s21::list<int> ll = {2, 4, 6, 8};
+  int calls = 0;
+  EXPECT_THROW(l.merge(ll,
+                       [&calls](int lhs, int rhs) {
+                         if (++calls == 4) {
+                           throw std::runtime_error("compare");
+                         }
+                         return lhs < rhs;
+                       }),
+               std::runtime_error);
+  EqualList(l, std::list<int>{1, 2, 3, 5, 7});
+  EqualList(ll, std::list<int>{4, 6, 8});
+  l.merge(ll);
+  EqualList(l, std::list<int>{1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_TRUE(ll.empty());
+}
+
+TEST_F(ListTest, SortWithoutBuffer) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  s21::list<int, Alloc> l{Alloc(&stats)};
+  std::list<int> s;
+  for (size_t i = 0; i < 2 * l.kSortBufferMin; ++i) {
+    int value = std::rand();
+    l.push_back(value);
+    s.push_back(value);
+  }
+  stats.max_bytes = sizeof(s21::ListNode<int>);
+  size_t allocations = stats.allocations;
+  l.sort(std::greater<int>());
+  s.sort(std::greater<int>());
+  EqualList(l, s);
+  EXPECT_EQ(stats.allocations, allocations);
+
+  stats.max_bytes = static_cast<size_t>(-1);
+  l.sort();
+  s.sort();
+  EqualList(l, s);
+  EXPECT_EQ(stats.allocations, allocations + 1);
+  EXPECT_EQ(stats.allocations - stats.deallocations, l.size() + 1);
+}
+
+TEST_F(ListTest, MergeUniquePredicate) {
+  auto greater = std::greater<int>();
+  s21::list<int> l = {9, 7, 7, 3};
+  std::list<int> s = {9, 7, 7, 3};
+  s21::list<int> ll = {8, 7, 2};
+  std::list<int> ss = {8, 7, 2};
+  l.merge(ll, greater);
+  s.merge(ss, greater);
+  EqualList(l, s);
+  EqualList(ll, ss);
+
+  auto same_tens = [](int lhs, int rhs) { return lhs / 10 == rhs / 10; };
+  l = {1, 5, 12, 19, 11, 25, 3};
+  s = {1, 5, 12, 19, 11, 25, 3};
+  l.unique(same_tens);
+  s.unique(same_tens);
+  EqualList(l, s);
+}
+
 TEST_F(ListTest, Reverse) {
   s21::list<int> l;
   std::list<int> s;
@@ -811,3 +1002,278 @@ TEST_F(ListTest, InsertManyFront) {
     EqualList(l, tmp);
   }
 }
+
+TEST_F(ListTest, StatefulAllocator) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::list<std::string, Alloc> l{Alloc(&stats)};
+    std::list<std::string> tmp;
+    for (int i = 0; i < 100; ++i) {
+      l.push_front(std::to_string(i % 17));
+      tmp.push_front(std::to_string(i % 17));
+    }
+    l.insert_many_back("a", "b");
+    tmp.insert(tmp.end(), {"a", "b"});
+    l.sort();
+    tmp.sort();
+    EqualList(l, tmp);
+    EXPECT_EQ(l.get_allocator(), Alloc(&stats));
+    EXPECT_EQ(stats.allocations - stats.deallocations, 103U);
+
+    s21::list<std::string, Alloc> copy(l);
+    EXPECT_EQ(copy.get_allocator(), Alloc(&stats));
+    EqualList(copy, tmp);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(ListTest, AllocatorPropagation) {
+  s21_test::AllocatorStats stats1;
+  s21_test::AllocatorStats stats2;
+  {
+    using Alloc = s21_test::CountingAllocator<int>;
+    s21::list<int, Alloc> l1({1, 2, 3}, Alloc(&stats1));
+    s21::list<int, Alloc> l2({4, 5}, Alloc(&stats2));
+
+    l2 = std::move(l1);
+    EXPECT_EQ(l2.get_allocator(), Alloc(&stats2));
+    EqualList(l2, std::list<int>{1, 2, 3});
+    EXPECT_TRUE(l1.empty());
+    l1 = l2;
+    EXPECT_EQ(l1.get_allocator(), Alloc(&stats1));
+    EqualList(l1, std::list<int>{1, 2, 3});
+
+    s21::list<int, Alloc> l3(std::move(l2), Alloc(&stats1));
+    EXPECT_EQ(l3.get_allocator(), Alloc(&stats1));
+    EqualList(l3, std::list<int>{1, 2, 3});
+  }
+  {
+    using Alloc = s21_test::CountingAllocator<int, true>;
+    s21::list<int, Alloc> l1({1, 2, 3}, Alloc(&stats1));
+    s21::list<int, Alloc> l2({4, 5}, Alloc(&stats2));
+
+    l2 = l1;
+    EXPECT_EQ(l2.get_allocator(), Alloc(&stats1));
+    l1.swap(l2);
+    l2 = std::move(l1);
+    EXPECT_EQ(l2.get_allocator(), Alloc(&stats1));
+    EqualList(l2, std::list<int>{1, 2, 3});
+  }
+  EXPECT_EQ(stats1.allocations, stats1.deallocations);
+  EXPECT_EQ(stats2.allocations, stats2.deallocations);
+}
+
+TEST_F(ListTest, EraseIf) {
+  std::list<int> tmp;
+  for (int value : s) {
+    if (value % 2 != 0) {
+      tmp.push_back(value);
+    }
+  }
+  size_t count = s21::erase_if(l, [](int x) { return x % 2 == 0; });
+  EXPECT_EQ(count, s.size() - tmp.size());
+  EqualList(l, tmp);
+
+  s21::list<std::string> strings = {"a", "b", "a"};
+  EXPECT_EQ(strings.remove_if([](const std::string &x) { return x == "a"; }),
+            2U);
+  EqualList(strings, std::list<std::string>{"b"});
+}
+
+TEST_F(ListTest, RemoveIfThrows) {
+  s21::list<int> numbers = {1, 2, 3, 4, 5, 6};
+  int calls = 0;
+  auto even = [&calls](int x) {
+    if (++calls == 4) {
+      throw std::runtime_error("predicate");
+    }
+    return x % 2 == 0;
+  };
+  EXPECT_THROW(numbers.remove_if(even), std::runtime_error);
+  EqualList(numbers, std::list<int>{1, 3, 4, 5, 6});
+}
+
+TEST_F(ListTest, NodePoolReusesNodes) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::list<std::string, Alloc> churn{Alloc(&stats)};
+    std::list<std::string> tmp;
+    churn.reserve_nodes(8);
+    size_t allocations = stats.allocations;
+    for (int i = 0; i < 1000; ++i) {
+      churn.push_back(std::to_string(i));
+      tmp.push_back(std::to_string(i));
+      if (i % 8 == 7) {
+        for (int j = 0; j < 6; ++j) {
+          churn.pop_front();
+          tmp.pop_front();
+        }
+      }
+    }
+    EqualList(churn, tmp);
+    // The pool doubles, so 250 live nodes take a few chunks.
+    EXPECT_LE(stats.allocations - allocations, 10U);
+
+    allocations = stats.allocations;
+    churn.clear();
+    churn.reserve_nodes(250);
+    for (int i = 0; i < 250; ++i) {
+      churn.push_front("x");
+    }
+    churn.unique();
+    EXPECT_EQ(churn.size(), 1U);
+    EXPECT_EQ(stats.allocations, allocations);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(ListTest, NodePoolShrink) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::list<int, Alloc> pooled({1, 2, 3}, Alloc(&stats));
+    size_t unpooled_bytes = stats.live_bytes;
+    pooled.reserve_nodes(100);
+    for (int i = 0; i < 100; ++i) {
+      pooled.push_back(i);
+    }
+    pooled.shrink();
+    EXPECT_GT(stats.live_bytes, unpooled_bytes);
+
+    pooled.clear();
+    pooled.shrink();
+    EXPECT_LT(stats.live_bytes, unpooled_bytes);
+    pooled.push_back(7);
+    EqualList(pooled, std::list<int>{7});
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(ListTest, NodePoolMergeThrows) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::list<int, Alloc> pooled{Alloc(&stats)};
+    pooled.reserve_nodes(4);
+    pooled.push_back(2);
+    pooled.push_back(4);
+    s21::list<int, Alloc> l({1, 3}, Alloc(&stats));
+    EXPECT_THROW(l.merge(pooled,
+                         [](int, int) -> bool {
+                           throw std::runtime_error("compare");
+                         }),
+                 std::runtime_error);
+    EqualList(l, std::list<int>{1, 3});
+    EqualList(pooled, std::list<int>{2, 4});
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(ListTest, NodePoolCopyAssign) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::list<int, Alloc> pooled({1, 2, 3}, Alloc(&stats));
+    pooled.reserve_nodes(8);
+    s21::list<int, Alloc> source({4, 5, 6, 7, 8, 9}, Alloc(&stats));
+    size_t allocations = stats.allocations;
+    pooled = source;
+    pooled.push_back(10);
+    pooled.push_front(3);
+    EqualList(pooled, std::list<int>{3, 4, 5, 6, 7, 8, 9, 10});
+    EXPECT_EQ(stats.allocations, allocations);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+
+  using PropagatingAlloc = s21_test::CountingAllocator<int, true>;
+  s21_test::AllocatorStats other_stats;
+  {
+    s21::list<int, PropagatingAlloc> pooled({1}, PropagatingAlloc(&stats));
+    pooled.reserve_nodes(8);
+    s21::list<int, PropagatingAlloc> source({2, 3},
+                                            PropagatingAlloc(&other_stats));
+    pooled = source;
+    EqualList(pooled, std::list<int>{2, 3});
+    EXPECT_EQ(stats.live_bytes, 0U);
+  }
+  EXPECT_EQ(other_stats.allocations, other_stats.deallocations);
+  EXPECT_EQ(other_stats.live_bytes, 0U);
+}
+
+TEST_F(ListTest, NodePoolTransfers) {
+  s21::list<std::string> pooled = {"b", "d"};
+  pooled.reserve_nodes(4);
+  pooled.push_back("f");
+  s21::list<std::string> other = {"a", "c", "e"};
+  pooled.merge(other);
+  EXPECT_TRUE(other.empty());
+  EqualList(pooled, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+
+  {
+    s21::list<std::string> target = {"x"};
+    target.splice(target.cbegin(), pooled);
+    s21::list<std::string> sorted = {"0"};
+    sorted.merge(target);
+    pooled.push_back("y");
+    pooled.swap(other);
+    other = s21::list<std::string>(std::move(other));
+    EqualList(sorted, std::list<std::string>{"0", "a", "b", "c", "d", "e",
+                                             "f", "x"});
+  }
+  EXPECT_TRUE(pooled.empty());
+  other.insert_many_back("z");
+  EqualList(other, std::list<std::string>{"y", "z"});
+}
+
+TEST_F(ListTest, MoveOnly) {
+  s21::list<std::unique_ptr<int>> l;
+  l.push_back(std::make_unique<int>(2));
+  l.push_front(std::make_unique<int>(0));
+  auto it = l.insert(--l.end(), std::make_unique<int>(1));
+  EXPECT_EQ(**it, 1);
+  EXPECT_EQ(*l.emplace_back(new int(4)), 4);
+  EXPECT_EQ(**l.emplace(--l.cend(), new int(3)), 3);
+  l.insert_many_back(std::make_unique<int>(5), std::make_unique<int>(6));
+  EXPECT_EQ(*l.emplace_front(new int(-1)), -1);
+  l.insert_many_front(std::make_unique<int>(-2));
+  EXPECT_EQ(l.size(), 9U);
+  int expected = -2;
+  for (const std::unique_ptr<int> &value : l) {
+    EXPECT_EQ(*value, expected++);
+  }
+
+  s21::list<std::unique_ptr<int>> pooled;
+  pooled.reserve_nodes(4);
+  pooled.emplace_back(new int(7));
+  l.splice(l.cend(), pooled);
+  s21::list<std::unique_ptr<int>> moved(std::move(l));
+  EXPECT_EQ(*moved.back(), 7);
+  EXPECT_EQ(moved.size(), 10U);
+}
+
+TEST_F(ListTest, EmplaceStrings) {
+  s21::list<std::string> l;
+  std::list<std::string> s;
+  std::string text(100, 'x');
+  l.push_back(std::move(text));
+  s.push_back(std::string(100, 'x'));
+  EXPECT_TRUE(text.empty());
+  l.emplace_back(3, 'y');
+  s.emplace_back(3, 'y');
+  l.emplace(l.cbegin(), "front");
+  s.emplace(s.cbegin(), "front");
+  EqualList(l, s);
+
+  // A throwing constructor leaves the list unchanged.
+  EXPECT_THROW(l.insert_many(++l.cbegin(), "a", std::string("b"),
+                             std::string(static_cast<size_t>(-1), 'c')),
+               std::length_error);
+  EqualList(l, s);
+}
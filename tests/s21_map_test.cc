@@ -1166,3 +1166,22 @@ TEST_F(MapTest, InsertMany) {
     EXPECT_TRUE(MapEqual(m, std_m));
   }
 }
+
+TEST_F(MapTest, EraseIf) {
+  s21::map<int, std::string> m;
+  std::map<int, std::string> std_m;
+  for (int i = 0; i < 100; ++i) {
+    m.insert(i, std::to_string(i));
+    if (i % 10 != 0) {
+      std_m.insert({i, std::to_string(i)});
+    }
+  }
+
+  using value_type = s21::map<int, std::string>::value_type;
+  size_t count = s21::erase_if(m, [](const value_type& x) {
+    return x.second.size() == 1 || x.second.back() == '0';
+  });
+  EXPECT_EQ(count, 19U);
+  std_m.erase(std_m.begin(), std_m.lower_bound(10));
+  EXPECT_TRUE(MapEqual(m, std_m));
+}
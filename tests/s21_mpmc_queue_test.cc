@@ -0,0 +1,145 @@
+#include "s21_mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class MpmcQueueTest : public ::testing::Test {
+ protected:
+  static constexpr int kThreads = 4;
+  static constexpr int64_t kPerThread = 1 << 16;
+
+  /*
+   *  Run kThreads producers and kThreads consumers. Producer p sends
+   *  p * kPerThread + i for i in [0, kPerThread). Every consumer checks
+   *  that the values of each producer arrive in order, and the counts
+   *  check that every value arrives exactly once.
+   */
+  template <typename Push, typename Pop>
+  void RunStress(Push push, Pop pop) {
+    std::vector<std::thread> threads;
+    std::vector<int64_t> sums(kThreads, 0);
+    std::vector<char> ordered(kThreads, 1);
+    for (int p = 0; p < kThreads; ++p) {
+      threads.emplace_back([p, push] {
+        for (int64_t i = 0; i < kPerThread; ++i) {
+          push(p * kPerThread + i);
+        }
+      });
+    }
+    for (int c = 0; c < kThreads; ++c) {
+      threads.emplace_back([c, pop, &sums, &ordered] {
+        std::vector<int64_t> last(kThreads, -1);
+        for (int64_t i = 0; i < kPerThread; ++i) {
+          int64_t value = pop();
+          int64_t producer = value / kPerThread;
+          if (value <= last[producer]) {
+            ordered[c] = 0;
+          }
+          last[producer] = value;
+          sums[c] += value;
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    int64_t total = 0;
+    for (int c = 0; c < kThreads; ++c) {
+      EXPECT_TRUE(ordered[c]);
+      total += sums[c];
+    }
+    int64_t count = kThreads * kPerThread;
+    EXPECT_EQ(total, count * (count - 1) / 2);
+  }
+};
+
+TEST_F(MpmcQueueTest, PushPop) {
+  s21::mpmc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8U);
+  EXPECT_EQ(s21::mpmc_queue<int>(0).capacity(), 2U);
+  EXPECT_TRUE(q.empty());
+
+  int out = -1;
+  EXPECT_FALSE(q.try_pop(out));
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(q.try_push(i));
+  }
+  EXPECT_FALSE(q.try_push(8));
+  EXPECT_EQ(q.size(), 8U);
+  for (int round = 0; round < 20; ++round) {
+    ASSERT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, round);
+    q.push(round + 8);
+  }
+  q.pop(out);
+  EXPECT_EQ(out, 20);
+  EXPECT_EQ(q.size(), 7U);
+}
+
+TEST_F(MpmcQueueTest, Emplace) {
+  s21::mpmc_queue<std::string> q(2);
+  std::string item(100, 'a');
+  EXPECT_TRUE(q.try_push(std::move(item)));
+  EXPECT_TRUE(q.try_emplace(3, 'b'));
+  item = std::string(100, 'c');
+  EXPECT_FALSE(q.try_push(std::move(item)));
+  EXPECT_EQ(item, std::string(100, 'c'));
+
+  q.pop(item);
+  EXPECT_EQ(item, std::string(100, 'a'));
+  q.emplace("d");
+  EXPECT_TRUE(q.try_pop(item));
+  EXPECT_EQ(item, "bbb");
+  q.pop(item);
+  EXPECT_EQ(item, "d");
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(MpmcQueueTest, ReleasesElements) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::mpmc_queue<std::string, Alloc> q(4, Alloc(&stats));
+    q.push(std::string(100, 'a'));
+    q.push(std::string(100, 'b'));
+    EXPECT_EQ(stats.allocations, 1U);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(MpmcQueueTest, StressNonblocking) {
+  s21::mpmc_queue<int64_t> q(64);
+  RunStress(
+      [&q](int64_t value) {
+        while (!q.try_push(value)) {
+          std::this_thread::yield();
+        }
+      },
+      [&q] {
+        int64_t value;
+        while (!q.try_pop(value)) {
+          std::this_thread::yield();
+        }
+        return value;
+      });
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(MpmcQueueTest, StressBlocking) {
+  s21::mpmc_queue<int64_t> q(4);
+  RunStress([&q](int64_t value) { q.push(value); },
+            [&q] {
+              int64_t value;
+              q.pop(value);
+              return value;
+            });
+  EXPECT_TRUE(q.empty());
+}
@@ -869,3 +869,12 @@ TEST_F(MultisetTest, InsertMany) {
     EXPECT_TRUE(MultisetEqual(s, std_s));
   }
 }
+
+TEST_F(MultisetTest, EraseIf) {
+  s21::multiset<std::string> s = {"a", "b", "a", "c", "b", "a"};
+  std::multiset<std::string> std_s = {"b", "c", "b"};
+
+  EXPECT_EQ(s21::erase_if(s, [](const std::string& x) { return x == "a"; }),
+            3U);
+  EXPECT_TRUE(MultisetEqual(s, std_s));
+}
@@ -0,0 +1,145 @@
+#include "s21_priority_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_vector.h"
+
+class PriorityQueueTest : public ::testing::Test {
+ protected:
+  void SetUp(void) override { srand(1); }
+
+  /*
+   *  Pop everything and check the values come out in descending order
+   *  and match expected.
+   */
+  template <typename Queue>
+  void DrainsSorted(Queue q, std::vector<int> expected) {
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    ASSERT_EQ(q.size(), expected.size());
+    for (int value : expected) {
+      ASSERT_EQ(q.top(), value);
+      q.pop();
+    }
+    EXPECT_TRUE(q.empty());
+  }
+
+  template <size_t Arity>
+  void RandomPushPop(void) {
+    s21::priority_queue<int, s21::vector<int>, s21::Less<int>, Arity> q;
+    std::vector<int> model;
+    for (int i = 0; i < 2000; ++i) {
+      if (rand() % 3 != 0 || model.empty()) {
+        int value = rand() % 100;
+        q.push(value);
+        model.push_back(value);
+        std::push_heap(model.begin(), model.end());
+      } else {
+        ASSERT_EQ(q.top(), model.front());
+        q.pop();
+        std::pop_heap(model.begin(), model.end());
+        model.pop_back();
+      }
+      ASSERT_EQ(q.size(), model.size());
+    }
+    DrainsSorted(q, model);
+  }
+};
+
+TEST_F(PriorityQueueTest, Ctors) {
+  s21::priority_queue<int> q;
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.size(), 0U);
+
+  std::vector<int> values = {5, 1, 9, 3, 7, 3, 8, 2, 6};
+  DrainsSorted(s21::priority_queue<int>(values.begin(), values.end()),
+               values);
+  DrainsSorted(s21::priority_queue<int>({4, 2, 8}), {4, 2, 8});
+  s21::vector<int> container = {1, 2, 3, 4, 5, 6, 7};
+  DrainsSorted(s21::priority_queue<int>(s21::Less<int>(), container),
+               {1, 2, 3, 4, 5, 6, 7});
+  DrainsSorted(
+      s21::priority_queue<int>(s21::Less<int>(), std::move(container)),
+      {1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST_F(PriorityQueueTest, HeapifyRandom) {
+  for (int n = 0; n < 50; ++n) {
+    std::vector<int> values;
+    for (int i = 0; i < n; ++i) {
+      values.push_back(rand() % 20);
+    }
+    using Heap4 = s21::priority_queue<int, s21::vector<int>, s21::Less<int>, 4>;
+    using Heap3 = s21::priority_queue<int, s21::vector<int>, s21::Less<int>, 3>;
+    DrainsSorted(s21::priority_queue<int>(values.begin(), values.end()),
+                 values);
+    DrainsSorted(Heap3(values.begin(), values.end()), values);
+    DrainsSorted(Heap4(values.begin(), values.end()), values);
+  }
+}
+
+TEST_F(PriorityQueueTest, PushPop) {
+  RandomPushPop<2>();
+  RandomPushPop<3>();
+  RandomPushPop<4>();
+  RandomPushPop<8>();
+}
+
+TEST_F(PriorityQueueTest, PopPush) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>, 4> q;
+  q.pop_push(10);
+  EXPECT_EQ(q.size(), 1U);
+  EXPECT_EQ(q.top(), 10);
+
+  for (int value : {7, 3, 12, 5}) {
+    q.push(value);
+  }
+  EXPECT_EQ(q.top(), 3);
+  q.pop_push(q.top() + 10);
+  EXPECT_EQ(q.top(), 5);
+  q.pop_push(1);
+  EXPECT_EQ(q.top(), 1);
+  EXPECT_EQ(q.size(), 5U);
+
+  std::vector<int> order;
+  for (; !q.empty(); q.pop()) {
+    order.push_back(q.top());
+  }
+  EXPECT_EQ(order, std::vector<int>({1, 7, 10, 12, 13}));
+}
+
+TEST_F(PriorityQueueTest, EmplaceMovesValues) {
+  s21::priority_queue<std::string> q;
+  q.emplace(3, 'b');
+  q.emplace("a");
+  std::string item(100, 'c');
+  q.push(std::move(item));
+  q.pop_push(std::string(100, 'd'));
+  EXPECT_EQ(q.top(), std::string(100, 'd'));
+  q.pop();
+  EXPECT_EQ(q.top(), "bbb");
+  q.pop();
+  EXPECT_EQ(q.top(), "a");
+}
+
+TEST_F(PriorityQueueTest, CopyMoveSwap) {
+  s21::priority_queue<int> q = {3, 1, 2};
+  s21::priority_queue<int> copy(q);
+  s21::priority_queue<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  DrainsSorted(moved, {1, 2, 3});
+
+  s21::priority_queue<int> other = {10};
+  other = q;
+  DrainsSorted(other, {1, 2, 3});
+  other = s21::priority_queue<int>({7, 8});
+  q.swap(other);
+  DrainsSorted(q, {7, 8});
+  DrainsSorted(other, {1, 2, 3});
+}
@@ -3,15 +3,35 @@
 #include <gtest/gtest.h>
 
 #include <cstdlib>
+#include <memory>
 #include <queue>
 #include <vector>
 
+#include "s21_list.h"
+#include "s21_ring_buffer.h"
+
+// The suite runs over the queue adaptor on its default deque and
+// on ring_buffer.
+struct DequeQueue {
+  template <typename T>
+  using type = s21::queue<T>;
+};
+
+struct RingQueue {
+  template <typename T>
+  using type = s21::ring_queue<T>;
+};
+
+template <typename Kind, typename T>
+using QueueOf = typename Kind::template type<T>;
+
+template <typename Kind>
 class QueueTest : public ::testing::Test {
  protected:
   void SetUp(void) override { std::srand(1); }
 
-  template <typename T>
-  void QueuesEqual(s21::queue<T> s, std::queue<T> ss) {
+  template <typename Queue, typename T>
+  void QueuesEqual(Queue s, std::queue<T> ss) {
     EXPECT_EQ(s.empty(), ss.empty());
     EXPECT_EQ(s.size(), ss.size());
     while (!ss.empty()) {
@@ -22,8 +42,8 @@ class QueueTest : public ::testing::Test {
     }
   }
 
-  template <typename T>
-  void QueuesEqual(s21::queue<T> s, s21::queue<T> ss) {
+  template <typename Queue>
+  void QueuesEqual(Queue s, Queue ss) {
     EXPECT_EQ(s.empty(), ss.empty());
     EXPECT_EQ(s.size(), ss.size());
     while (!ss.empty()) {
@@ -39,18 +59,21 @@ class QueueTest : public ::testing::Test {
   std::vector<double> v3 = {3.1, 3.2, 3.3};
 };
 
-TEST_F(QueueTest, DeafultCtor) {
-  s21::queue<std::vector<int>> q;
+using QueueKinds = ::testing::Types<DequeQueue, RingQueue>;
+TYPED_TEST_SUITE(QueueTest, QueueKinds);
+
+TYPED_TEST(QueueTest, DeafultCtor) {
+  QueueOf<TypeParam, std::vector<int>> q;
   EXPECT_TRUE(q.empty());
   EXPECT_EQ(q.size(), 0);
 
-  const s21::queue<std::vector<int>> cq;
+  const QueueOf<TypeParam, std::vector<int>> cq;
   EXPECT_TRUE(cq.empty());
   EXPECT_EQ(cq.size(), 0);
 }
 
-TEST_F(QueueTest, InitializerCtor) {
-  s21::queue<int> q = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+TYPED_TEST(QueueTest, InitializerCtor) {
+  QueueOf<TypeParam, int> q = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
   EXPECT_FALSE(q.empty());
   EXPECT_EQ(q.size(), 10);
   EXPECT_EQ(q.front(), 0);
@@ -64,21 +87,21 @@ TEST_F(QueueTest, InitializerCtor) {
   }
 }
 
-TEST_F(QueueTest, CopyCtor) {
-  s21::queue<int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-  s21::queue<int> q(copy);
+TYPED_TEST(QueueTest, CopyCtor) {
+  QueueOf<TypeParam, int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  QueueOf<TypeParam, int> q(copy);
 
   EXPECT_FALSE(q.empty());
   EXPECT_EQ(q.size(), 10);
   EXPECT_EQ(q.front(), 0);
   EXPECT_EQ(q.back(), 9);
 
-  QueuesEqual(q, copy);
+  this->QueuesEqual(q, copy);
 }
 
-TEST_F(QueueTest, MoveCtor) {
-  s21::queue<int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-  s21::queue<int> q(std::move(copy));
+TYPED_TEST(QueueTest, MoveCtor) {
+  QueueOf<TypeParam, int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  QueueOf<TypeParam, int> q(std::move(copy));
 
   EXPECT_TRUE(copy.empty());
   EXPECT_EQ(copy.size(), 0);
@@ -96,9 +119,9 @@ TEST_F(QueueTest, MoveCtor) {
   }
 }
 
-TEST_F(QueueTest, CopyOperatorAssign) {
-  s21::queue<int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-  s21::queue<int> q = {1, 2, 3};
+TYPED_TEST(QueueTest, CopyOperatorAssign) {
+  QueueOf<TypeParam, int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  QueueOf<TypeParam, int> q = {1, 2, 3};
 
   q = copy;
 
@@ -107,12 +130,12 @@ TEST_F(QueueTest, CopyOperatorAssign) {
   EXPECT_EQ(q.front(), 0);
   EXPECT_EQ(q.back(), 9);
 
-  QueuesEqual(q, copy);
+  this->QueuesEqual(q, copy);
 }
 
-TEST_F(QueueTest, MoveOperatorAssign) {
-  s21::queue<int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-  s21::queue<int> q = {1, 2, 3};
+TYPED_TEST(QueueTest, MoveOperatorAssign) {
+  QueueOf<TypeParam, int> copy = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  QueueOf<TypeParam, int> q = {1, 2, 3};
 
   q = std::move(copy);
 
@@ -132,11 +155,11 @@ TEST_F(QueueTest, MoveOperatorAssign) {
   }
 }
 
-TEST_F(QueueTest, Capacity) {
-  const s21::queue<double> q1;
-  const s21::queue<double> q2 = {1, 2, 3, 4, 5};
-  s21::queue<double> q3;
-  s21::queue<double> q4;
+TYPED_TEST(QueueTest, Capacity) {
+  const QueueOf<TypeParam, double> q1;
+  const QueueOf<TypeParam, double> q2 = {1, 2, 3, 4, 5};
+  QueueOf<TypeParam, double> q3;
+  QueueOf<TypeParam, double> q4;
 
   EXPECT_TRUE(q1.empty());
   EXPECT_FALSE(q2.empty());
@@ -153,8 +176,8 @@ TEST_F(QueueTest, Capacity) {
   EXPECT_EQ(q4.size(), 100000);
 }
 
-TEST_F(QueueTest, PushPopFrontBack) {
-  s21::queue<int> q;
+TYPED_TEST(QueueTest, PushPopFrontBack) {
+  QueueOf<TypeParam, int> q;
   std::queue<int> qq;
 
   for (int i = 0; i < 100000; ++i) {
@@ -164,59 +187,59 @@ TEST_F(QueueTest, PushPopFrontBack) {
   }
 
   // Pop, Front and Back are called in QueuesEqual
-  QueuesEqual(q, qq);
+  this->QueuesEqual(q, qq);
 
   q.front() = 19;
   q.back() = -19;
   qq.front() = 19;
   qq.back() = -19;
 
-  QueuesEqual(q, qq);
+  this->QueuesEqual(q, qq);
 }
 
-TEST_F(QueueTest, PushPopFrontBackVector) {
-  s21::queue<std::vector<double>> q;
+TYPED_TEST(QueueTest, PushPopFrontBackVector) {
+  QueueOf<TypeParam, std::vector<double>> q;
   std::queue<std::vector<double>> qq;
 
-  q.push(v1);
-  q.push(v2);
-  q.push(v3);
-  qq.push(v1);
-  qq.push(v2);
-  qq.push(v3);
+  q.push(this->v1);
+  q.push(this->v2);
+  q.push(this->v3);
+  qq.push(this->v1);
+  qq.push(this->v2);
+  qq.push(this->v3);
 
   // Pop, Front and Back are called in QueuesEqual
-  QueuesEqual(q, qq);
+  this->QueuesEqual(q, qq);
 }
 
-TEST_F(QueueTest, Swap) {
-  s21::queue<std::vector<double>> q1;
-  s21::queue<std::vector<double>> q2;
+TYPED_TEST(QueueTest, Swap) {
+  QueueOf<TypeParam, std::vector<double>> q1;
+  QueueOf<TypeParam, std::vector<double>> q2;
   std::queue<std::vector<double>> qq1;
   std::queue<std::vector<double>> qq2;
 
-  q1.push(v1);
-  q1.push(v2);
-  q1.push(v3);
-  q2.push(v3);
-  q2.push(v1);
-  qq1.push(v1);
-  qq1.push(v2);
-  qq1.push(v3);
-  qq2.push(v3);
-  qq2.push(v1);
+  q1.push(this->v1);
+  q1.push(this->v2);
+  q1.push(this->v3);
+  q2.push(this->v3);
+  q2.push(this->v1);
+  qq1.push(this->v1);
+  qq1.push(this->v2);
+  qq1.push(this->v3);
+  qq2.push(this->v3);
+  qq2.push(this->v1);
 
   q1.swap(q2);
   qq1.swap(qq2);
 
   // Pop, Front and Back are called in QueuesEqual
-  QueuesEqual(q1, qq1);
-  QueuesEqual(q2, qq2);
+  this->QueuesEqual(q1, qq1);
+  this->QueuesEqual(q2, qq2);
 }
 
-TEST_F(QueueTest, InsertManyBack) {
+TYPED_TEST(QueueTest, InsertManyBack) {
   {
-    s21::queue<double> q = {1.0, 2.0};
+    QueueOf<TypeParam, double> q = {1.0, 2.0};
     q.insert_many_back(3, 4.4, 5.0f, 6L);
 
     std::queue<double> std_q;
@@ -227,10 +250,10 @@ TEST_F(QueueTest, InsertManyBack) {
     std_q.push(5.0);
     std_q.push(6.0);
 
-    QueuesEqual(q, std_q);
+    this->QueuesEqual(q, std_q);
   }
   {
-    s21::queue<double> q = {1.0, 2.0};
+    QueueOf<TypeParam, double> q = {1.0, 2.0};
     q.insert_many_back(3, 4.4);
 
     std::queue<double> std_q;
@@ -239,10 +262,10 @@ TEST_F(QueueTest, InsertManyBack) {
     std_q.push(3.0);
     std_q.push(4.4);
 
-    QueuesEqual(q, std_q);
+    this->QueuesEqual(q, std_q);
   }
   {
-    s21::queue<double> q = {1.0, 2.0};
+    QueueOf<TypeParam, double> q = {1.0, 2.0};
     q.insert_many_back(3);
 
     std::queue<double> std_q;
@@ -250,16 +273,68 @@ TEST_F(QueueTest, InsertManyBack) {
     std_q.push(2.0);
     std_q.push(3.0);
 
-    QueuesEqual(q, std_q);
+    this->QueuesEqual(q, std_q);
   }
   {
-    s21::queue<double> q = {1.0, 2.0};
+    QueueOf<TypeParam, double> q = {1.0, 2.0};
     q.insert_many_back();
 
     std::queue<double> std_q;
     std_q.push(1.0);
     std_q.push(2.0);
 
-    QueuesEqual(q, std_q);
+    this->QueuesEqual(q, std_q);
   }
 }
+
+TYPED_TEST(QueueTest, MoveOnly) {
+  QueueOf<TypeParam, std::unique_ptr<int>> q;
+  s21::queue<std::unique_ptr<int>, s21::list<std::unique_ptr<int>>> lq;
+  q.push(std::make_unique<int>(1));
+  lq.push(std::make_unique<int>(1));
+  EXPECT_EQ(*q.emplace(new int(2)), 2);
+  EXPECT_EQ(*lq.emplace(new int(2)), 2);
+  q.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  lq.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  EXPECT_EQ(*q.back(), 4);
+  EXPECT_EQ(lq.size(), 4U);
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_EQ(*q.front(), i);
+    EXPECT_EQ(*lq.front(), i);
+    q.pop();
+    lq.pop();
+  }
+}
+
+class QueueListTest : public ::testing::Test {
+ protected:
+  void SetUp(void) override { std::srand(1); }
+};
+
+TEST_F(QueueListTest, ListContainer) {
+  s21::queue<int, s21::list<int>> q(s21::list<int>{1, 2});
+  std::queue<int> std_q;
+  std_q.push(1);
+  std_q.push(2);
+  for (int i = 0; i < 1000; ++i) {
+    int value = std::rand();
+    q.push(value);
+    std_q.push(value);
+    if (value % 3 == 0) {
+      q.pop();
+      std_q.pop();
+    }
+  }
+  q.insert_many_back(7, 8);
+  std_q.push(7);
+  std_q.push(8);
+  s21::queue<int, s21::list<int>> copy(q);
+  EXPECT_EQ(copy.size(), std_q.size());
+  while (!std_q.empty()) {
+    EXPECT_EQ(copy.front(), std_q.front());
+    EXPECT_EQ(copy.back(), 8);
+    copy.pop();
+    std_q.pop();
+  }
+  EXPECT_TRUE(copy.empty());
+}
@@ -0,0 +1,178 @@
+#include "s21_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class RingBufferTest : public ::testing::Test {
+ protected:
+  void SetUp(void) override { std::srand(1); }
+
+  template <typename T, typename A>
+  bool BufferEqual(const s21::ring_buffer<T, A> &lhs,
+                   const std::deque<T> &rhs) {
+    if (lhs.empty() != rhs.empty() || lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < rhs.size(); ++i) {
+      if (lhs[i] != rhs[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+TEST_F(RingBufferTest, Constructors) {
+  s21::ring_buffer<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.capacity(), 0U);
+
+  s21::ring_buffer<std::string> items = {"a", "b", "c"};
+  EXPECT_TRUE(BufferEqual(items, std::deque<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(items.capacity(), 8U);
+
+  s21::ring_buffer<std::string> copy(items);
+  EXPECT_TRUE(BufferEqual(copy, std::deque<std::string>{"a", "b", "c"}));
+  s21::ring_buffer<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_TRUE(BufferEqual(moved, std::deque<std::string>{"a", "b", "c"}));
+
+  copy = moved;
+  moved = s21::ring_buffer<std::string>{"x"};
+  EXPECT_TRUE(BufferEqual(copy, std::deque<std::string>{"a", "b", "c"}));
+  EXPECT_TRUE(BufferEqual(moved, std::deque<std::string>{"x"}));
+  copy.swap(moved);
+  EXPECT_EQ(copy.front(), "x");
+  EXPECT_EQ(moved.back(), "c");
+}
+
+TEST_F(RingBufferTest, WrapAround) {
+  s21::ring_buffer<std::string> s21_buf;
+  std::deque<std::string> std_buf;
+  for (int i = 0; i < 20000; ++i) {
+    int value = std::rand();
+    if (value % 3 != 0 || std_buf.empty()) {
+      s21_buf.push_back(std::to_string(value));
+      std_buf.push_back(std::to_string(value));
+    } else {
+      s21_buf.pop_front();
+      std_buf.pop_front();
+    }
+    ASSERT_EQ(s21_buf.front(), std_buf.front());
+    ASSERT_EQ(s21_buf.back(), std_buf.back());
+  }
+  EXPECT_TRUE(BufferEqual(s21_buf, std_buf));
+  size_t capacity = s21_buf.capacity();
+  EXPECT_EQ(capacity & (capacity - 1), 0U);
+  EXPECT_THROW(s21_buf.at(s21_buf.size()), std::out_of_range);
+  s21_buf.clear();
+  EXPECT_TRUE(s21_buf.empty());
+  EXPECT_EQ(s21_buf.capacity(), capacity);
+}
+
+TEST_F(RingBufferTest, PushAliasedValue) {
+  s21::ring_buffer<std::string> buf;
+  for (int i = 0; i < 8; ++i) {
+    buf.push_back(std::to_string(i));
+  }
+  buf.pop_front();
+  buf.push_back("8");
+  buf.push_back(buf.front());
+  EXPECT_EQ(buf.capacity(), 16U);
+  EXPECT_EQ(buf.back(), "1");
+  EXPECT_EQ(buf.at(7), "8");
+}
+
+TEST_F(RingBufferTest, BulkOperations) {
+  s21::ring_buffer<int> ints;
+  std::vector<int> source(100);
+  for (int i = 0; i < 100; ++i) {
+    source[i] = i;
+  }
+  ints.reserve(64);
+  EXPECT_EQ(ints.capacity(), 64U);
+  std::vector<int> out(100);
+  int expected = 0;
+  for (int round = 0; round < 50; ++round) {
+    ints.push_n(source.data(), 40);
+    size_t popped = ints.pop_n(out.data(), 30 + round % 20);
+    for (size_t i = 0; i < popped; ++i) {
+      ASSERT_EQ(out[i], expected);
+      expected = (expected + 1) % 40;
+    }
+  }
+  size_t rest = ints.size();
+  EXPECT_EQ(ints.pop_n(out.data(), 100), rest);
+  EXPECT_EQ(out[rest - 1], 39);
+  EXPECT_TRUE(ints.empty());
+
+  s21::ring_buffer<std::string> strings = {"a"};
+  std::vector<std::string> words = {"b", "c", "d"};
+  strings.push_n(words.data(), words.size());
+  std::vector<std::string> popped(5);
+  EXPECT_EQ(strings.pop_n(popped.data(), 5), 4U);
+  EXPECT_EQ(popped[0], "a");
+  EXPECT_EQ(popped[3], "d");
+  EXPECT_TRUE(strings.empty());
+}
+
+TEST_F(RingBufferTest, SteadyStateDoesNotAllocate) {
+  using Alloc = s21_test::CountingAllocator<int>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::ring_buffer<int, Alloc> buf{Alloc(&stats)};
+    for (int i = 0; i < 1000; ++i) {
+      buf.push_back(i);
+    }
+    size_t allocations = stats.allocations;
+    for (int i = 1000; i < 100000; ++i) {
+      buf.pop_front();
+      buf.push_back(i);
+    }
+    EXPECT_EQ(stats.allocations, allocations);
+    EXPECT_EQ(buf.front(), 99000);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(RingBufferTest, RingQueue) {
+  s21::ring_queue<int> q = {0, 1, 2};
+  std::queue<int> std_q;
+  for (int i = 0; i < 3; ++i) {
+    std_q.push(i);
+  }
+  for (int i = 0; i < 10000; ++i) {
+    int value = std::rand();
+    q.push(value);
+    std_q.push(value);
+    if (value % 2 == 0) {
+      q.pop();
+      std_q.pop();
+    }
+    ASSERT_EQ(q.size(), std_q.size());
+    ASSERT_EQ(q.front(), std_q.front());
+    ASSERT_EQ(q.back(), std_q.back());
+  }
+  int values[] = {7, 8, 9};
+  q.push_n(values, 3);
+  EXPECT_EQ(q.back(), 9);
+  int out[2];
+  EXPECT_EQ(q.pop_n(out, 2), 2U);
+  EXPECT_EQ(out[0], std_q.front());
+
+  s21::ring_queue<int> copy(q);
+  s21::ring_queue<int> moved(std::move(q));
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(copy.size(), moved.size());
+}
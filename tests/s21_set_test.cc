@@ -737,3 +737,21 @@ TEST_F(SetTest, InsertMany) {
     EXPECT_TRUE(SetEqual(s, std_s));
   }
 }
+
+TEST_F(SetTest, EraseIf) {
+  s21::set<int> s;
+  std::set<int> std_s;
+  for (int i = 0; i < 1000; ++i) {
+    s.insert(i * 7 % 1000);
+    std_s.insert(i * 7 % 1000);
+  }
+  for (auto it = std_s.begin(); it != std_s.end();) {
+    it = *it % 3 == 0 ? std_s.erase(it) : std::next(it);
+  }
+
+  EXPECT_EQ(s21::erase_if(s, [](int x) { return x % 3 == 0; }), 334U);
+  EXPECT_TRUE(SetEqual(s, std_s));
+  EXPECT_EQ(s21::erase_if(s, [](int) { return false; }), 0U);
+  EXPECT_EQ(s21::erase_if(s, [](int) { return true; }), 666U);
+  EXPECT_TRUE(s.empty());
+}
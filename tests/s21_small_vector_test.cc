@@ -0,0 +1,269 @@
+#include "s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class SmallVectorTest : public ::testing::Test {
+ public:
+  template <typename T, size_t N, typename A>
+  bool VectorEqual(const s21::small_vector<T, N, A> &lhs,
+                   const std::vector<T> &rhs) {
+    return lhs.empty() == rhs.empty() && lhs.size() == rhs.size() &&
+           lhs.capacity() >= lhs.size() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+};
+
+TEST_F(SmallVectorTest, StaysInline) {
+  s21::small_vector<std::string, 4> s21_vec;
+  std::vector<std::string> std_vec;
+  EXPECT_TRUE(s21_vec.is_inline());
+  EXPECT_EQ(s21_vec.capacity(), 4U);
+
+  for (int i = 0; i < 4; ++i) {
+    s21_vec.push_back(std::to_string(i));
+    std_vec.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(s21_vec.is_inline());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21_vec.push_back("spill");
+  std_vec.push_back("spill");
+  EXPECT_FALSE(s21_vec.is_inline());
+  EXPECT_EQ(s21_vec.capacity(), 8U);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21_vec.pop_back();
+  std_vec.pop_back();
+  s21_vec.shrink_to_fit();
+  EXPECT_TRUE(s21_vec.is_inline());
+  EXPECT_EQ(s21_vec.capacity(), 4U);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+}
+
+TEST_F(SmallVectorTest, Constructors) {
+  s21::small_vector<int, 8> sized(5);
+  EXPECT_TRUE(sized.is_inline());
+  EXPECT_TRUE(VectorEqual(sized, std::vector<int>(5)));
+
+  s21::small_vector<int, 2> large(100);
+  EXPECT_FALSE(large.is_inline());
+  EXPECT_EQ(large.capacity(), 100U);
+  EXPECT_TRUE(VectorEqual(large, std::vector<int>(100)));
+
+  s21::small_vector<std::string, 2> items = {"a", "b", "c"};
+  EXPECT_TRUE(VectorEqual(items, std::vector<std::string>{"a", "b", "c"}));
+
+  s21::small_vector<std::string, 2> copy(items);
+  EXPECT_TRUE(VectorEqual(copy, std::vector<std::string>{"a", "b", "c"}));
+  s21::small_vector<std::string, 2> small = {"x"};
+  s21::small_vector<std::string, 2> small_copy(small);
+  EXPECT_TRUE(small_copy.is_inline());
+  EXPECT_EQ(small_copy[0], "x");
+}
+
+TEST_F(SmallVectorTest, Move) {
+  s21::small_vector<std::string, 4> small = {"a", "b"};
+  s21::small_vector<std::string, 4> moved(std::move(small));
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_TRUE(small.empty());
+  EXPECT_TRUE(VectorEqual(moved, std::vector<std::string>{"a", "b"}));
+
+  s21::small_vector<std::string, 4> large = {"1", "2", "3", "4", "5"};
+  const std::string *data = large.data();
+  s21::small_vector<std::string, 4> stolen(std::move(large));
+  EXPECT_EQ(stolen.data(), data);
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+
+  moved = std::move(stolen);
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved.size(), 5U);
+  stolen = std::move(small);
+  EXPECT_TRUE(stolen.empty());
+  small = {"c"};
+  moved = std::move(small);
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_TRUE(VectorEqual(moved, std::vector<std::string>{"c"}));
+
+  s21::small_vector<std::string, 4> assigned;
+  assigned = moved;
+  EXPECT_TRUE(VectorEqual(assigned, std::vector<std::string>{"c"}));
+  assigned = s21::small_vector<std::string, 4>(7);
+  EXPECT_TRUE(VectorEqual(assigned, std::vector<std::string>(7)));
+}
+
+TEST_F(SmallVectorTest, Swap) {
+  using Vector = s21::small_vector<std::string, 3>;
+  std::vector<std::string> one = {"1"};
+  std::vector<std::string> three = {"1", "2", "3"};
+  std::vector<std::string> five = {"1", "2", "3", "4", "5"};
+  std::vector<std::string> six = {"6", "5", "4", "3", "2", "1"};
+
+  Vector a = {"1"};
+  Vector b = {"1", "2", "3"};
+  a.swap(b);
+  EXPECT_TRUE(VectorEqual(a, three));
+  EXPECT_TRUE(VectorEqual(b, one));
+
+  Vector c = {"1", "2", "3", "4", "5"};
+  a.swap(c);
+  EXPECT_FALSE(a.is_inline());
+  EXPECT_TRUE(c.is_inline());
+  EXPECT_TRUE(VectorEqual(a, five));
+  EXPECT_TRUE(VectorEqual(c, three));
+  c.swap(a);
+  EXPECT_TRUE(VectorEqual(a, three));
+  EXPECT_TRUE(VectorEqual(c, five));
+
+  Vector d = {"6", "5", "4", "3", "2", "1"};
+  c.swap(d);
+  EXPECT_TRUE(VectorEqual(c, six));
+  EXPECT_TRUE(VectorEqual(d, five));
+}
+
+TEST_F(SmallVectorTest, Access) {
+  s21::small_vector<int, 4> v = {1, 2, 3};
+  const s21::small_vector<int, 4> &cv = v;
+  EXPECT_EQ(v.at(1), 2);
+  EXPECT_EQ(cv.at(2), 3);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(cv.back(), 3);
+  EXPECT_EQ(*cv.data(), 1);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  EXPECT_THROW(cv.at(3), std::out_of_range);
+  v[0] = 10;
+  EXPECT_EQ(cv[0], 10);
+  EXPECT_EQ(std::distance(cv.begin(), cv.end()), 3);
+  EXPECT_GE(v.max_size(), v.size());
+}
+
+TEST_F(SmallVectorTest, Modifiers) {
+  s21::small_vector<std::string, 4> s21_vec;
+  std::vector<std::string> std_vec;
+  for (int i = 0; i < 20; ++i) {
+    std::string value = std::to_string(i);
+    size_t pos = i % 3 == 0 ? 0 : s21_vec.size() / 2;
+    s21_vec.insert(s21_vec.begin() + pos, value);
+    std_vec.insert(std_vec.begin() + pos, value);
+    EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  }
+  s21_vec.insert(s21_vec.begin() + 3, 5, s21_vec[0]);
+  std_vec.insert(std_vec.begin() + 3, 5, std_vec[0]);
+  s21_vec.insert(s21_vec.end(), std_vec.begin(), std_vec.begin() + 4);
+  std_vec.insert(std_vec.end(), std_vec.begin(), std_vec.begin() + 4);
+  s21_vec.emplace(s21_vec.begin() + 1, 3, 'z');
+  std_vec.emplace(std_vec.begin() + 1, 3, 'z');
+  s21_vec.emplace_back("back");
+  std_vec.emplace_back("back");
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  while (!s21_vec.empty()) {
+    s21_vec.erase(s21_vec.begin() + s21_vec.size() / 2);
+    std_vec.erase(std_vec.begin() + std_vec.size() / 2);
+    EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  }
+
+  s21_vec.reserve(100);
+  EXPECT_EQ(s21_vec.capacity(), 100U);
+  s21_vec.push_back("a");
+  s21_vec.clear();
+  EXPECT_TRUE(s21_vec.empty());
+  s21_vec.shrink_to_fit();
+  EXPECT_TRUE(s21_vec.is_inline());
+}
+
+TEST_F(SmallVectorTest, ResizeAndEraseRange) {
+  s21::small_vector<std::string, 4> s21_vec = {"a", "b"};
+  std::vector<std::string> std_vec = {"a", "b"};
+  s21_vec.resize(3);
+  std_vec.resize(3);
+  EXPECT_TRUE(s21_vec.is_inline());
+  s21_vec.resize(6, s21_vec[0]);
+  std_vec.resize(6, std_vec[0]);
+  EXPECT_FALSE(s21_vec.is_inline());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  auto it = s21_vec.erase(s21_vec.begin() + 1, s21_vec.begin() + 4);
+  std_vec.erase(std_vec.begin() + 1, std_vec.begin() + 4);
+  EXPECT_EQ(it, s21_vec.begin() + 1);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.erase(s21_vec.begin(), s21_vec.begin());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.resize(1);
+  std_vec.resize(1);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21::small_vector<int, 2> ints(2);
+  ints.resize(5, 7);
+  EXPECT_TRUE(VectorEqual(ints, std::vector<int>{0, 0, 7, 7, 7}));
+  auto last = ints.erase(ints.begin() + 1, ints.end());
+  EXPECT_EQ(last, ints.end());
+  EXPECT_TRUE(VectorEqual(ints, std::vector<int>{0}));
+}
+
+TEST_F(SmallVectorTest, InputIterators) {
+  std::istringstream stream("1 2 3 4 5 6");
+  s21::small_vector<int, 4> v = {0, 7};
+  v.insert(v.begin() + 1, std::istream_iterator<int>(stream),
+           std::istream_iterator<int>());
+  EXPECT_TRUE(VectorEqual(v, std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST_F(SmallVectorTest, InsertMany) {
+  s21::small_vector<std::string, 4> v = {"a", "e"};
+  auto it = v.insert_many(v.begin() + 1, "b", "c", std::string("d"));
+  EXPECT_EQ(*it, "e");
+  v.insert_many_back("f", "g");
+  v.insert_many_back();
+  EXPECT_TRUE(VectorEqual(
+      v, std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g"}));
+
+  s21::small_vector<int, 8> ints;
+  ints.insert_many_back(1, 2, 3);
+  ints.insert_many(ints.begin(), -1, 0);
+  EXPECT_TRUE(ints.is_inline());
+  EXPECT_TRUE(VectorEqual(ints, std::vector<int>{-1, 0, 1, 2, 3}));
+}
+
+TEST_F(SmallVectorTest, MoveOnlyValues) {
+  s21::small_vector<std::unique_ptr<int>, 2> v;
+  for (int i = 0; i < 5; ++i) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  v.emplace(v.begin(), new int(-1));
+  s21::small_vector<std::unique_ptr<int>, 2> moved(std::move(v));
+  EXPECT_EQ(moved.size(), 6U);
+  EXPECT_EQ(*moved.front(), -1);
+  EXPECT_EQ(*moved.back(), 4);
+}
+
+TEST_F(SmallVectorTest, StatefulAllocator) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::small_vector<std::string, 8, Alloc> v{Alloc(&stats)};
+    for (int i = 0; i < 8; ++i) {
+      v.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(stats.allocations, 0U);
+    v.push_back("8");
+    EXPECT_EQ(stats.allocations, 1U);
+    EXPECT_EQ(v.get_allocator(), Alloc(&stats));
+
+    s21::small_vector<std::string, 8, Alloc> copy(v);
+    EXPECT_EQ(copy.get_allocator(), Alloc(&stats));
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), copy.begin()));
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
@@ -0,0 +1,198 @@
+#include "s21_spsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class SpscQueueTest : public ::testing::Test {
+ protected:
+  // Counts live objects; a negative value refuses to be moved out.
+  struct Tracked {
+    explicit Tracked(int value = 0) : value(value) { ++live; }
+    Tracked(const Tracked &other) : value(other.value) { ++live; }
+    ~Tracked(void) { --live; }
+
+    Tracked &operator=(Tracked &&other) {
+      if (other.value < 0) {
+        throw std::runtime_error("move");
+      }
+      value = other.value;
+      return *this;
+    }
+
+    int value;
+    static inline int live = 0;
+  };
+};
+
+TEST_F(SpscQueueTest, PushPop) {
+  s21::spsc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8U);
+  EXPECT_EQ(s21::spsc_queue<int>(0).capacity(), 1U);
+  EXPECT_TRUE(q.empty());
+
+  int out = -1;
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_EQ(q.front(), nullptr);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(q.try_push(i));
+  }
+  EXPECT_FALSE(q.try_push(8));
+  EXPECT_EQ(q.size(), 8U);
+
+  for (int round = 0; round < 20; ++round) {
+    ASSERT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, round);
+    ASSERT_TRUE(q.try_push(round + 8));
+  }
+  EXPECT_EQ(*q.front(), 20);
+  q.pop();
+  EXPECT_EQ(q.size(), 7U);
+}
+
+TEST_F(SpscQueueTest, EmplaceInPlace) {
+  s21::spsc_queue<std::string> q(2);
+  EXPECT_TRUE(q.try_emplace("a"));
+  EXPECT_TRUE(q.try_emplace(3, 'b'));
+  std::string item(100, 'c');
+  EXPECT_FALSE(q.try_push(std::move(item)));
+  EXPECT_EQ(item, std::string(100, 'c'));
+
+  std::string *front = q.front();
+  ASSERT_NE(front, nullptr);
+  EXPECT_EQ(*front, "a");
+  *front += "x";
+  EXPECT_EQ(*q.front(), "ax");
+  q.pop();
+  EXPECT_TRUE(q.try_pop(item));
+  EXPECT_EQ(item, "bbb");
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(SpscQueueTest, Batches) {
+  s21::spsc_queue<int64_t> q(16);
+  std::vector<int64_t> in(40);
+  for (int64_t i = 0; i < 40; ++i) {
+    in[i] = i;
+  }
+  std::vector<int64_t> out(40);
+  EXPECT_EQ(q.try_push_n(in.data(), 10), 10U);
+  EXPECT_EQ(q.try_pop_n(out.data(), 7), 7U);
+  EXPECT_EQ(q.try_push_n(in.data() + 10, 30), 13U);
+  EXPECT_EQ(q.try_pop_n(out.data() + 7, 40), 16U);
+  EXPECT_EQ(q.try_pop_n(out.data(), 1), 0U);
+  for (int64_t i = 0; i < 23; ++i) {
+    EXPECT_EQ(out[i], i);
+  }
+
+  s21::spsc_queue<std::string> strings(4);
+  std::string words[] = {"a", "b", "c", "d", "e", "f"};
+  std::string result[6];
+  EXPECT_EQ(strings.try_push_n(words, 3), 3U);
+  EXPECT_EQ(strings.try_pop_n(result, 2), 2U);
+  EXPECT_EQ(strings.try_push_n(words + 3, 3), 3U);
+  EXPECT_EQ(strings.try_pop_n(result + 2, 6), 4U);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(result[i], words[i]);
+  }
+}
+
+TEST_F(SpscQueueTest, PopBatchThrows) {
+  {
+    s21::spsc_queue<Tracked> q(8);
+    Tracked in[] = {Tracked(1), Tracked(2), Tracked(-1), Tracked(4)};
+    EXPECT_EQ(q.try_push_n(in, 4), 4U);
+    Tracked out[4];
+    EXPECT_THROW(q.try_pop_n(out, 4), std::runtime_error);
+    EXPECT_EQ(out[0].value, 1);
+    EXPECT_EQ(out[1].value, 2);
+    EXPECT_EQ(q.size(), 2U);
+    EXPECT_EQ(q.front()->value, -1);
+    q.pop();
+    EXPECT_EQ(q.try_pop_n(out, 4), 1U);
+    EXPECT_EQ(out[0].value, 4);
+    EXPECT_EQ(Tracked::live, 8);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST_F(SpscQueueTest, ReleasesElements) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::spsc_queue<std::string, Alloc> q(4, Alloc(&stats));
+    q.try_push(std::string(100, 'a'));
+    q.try_push(std::string(100, 'b'));
+    EXPECT_EQ(stats.allocations, 1U);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(SpscQueueTest, StressFifo) {
+  constexpr int64_t kCount = 1 << 20;
+  s21::spsc_queue<int64_t> q(64);
+  std::thread producer([&q] {
+    for (int64_t i = 0; i < kCount; ++i) {
+      while (!q.try_push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int64_t expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    int64_t value;
+    if (q.try_pop(value)) {
+      ordered = ordered && value == expected;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST_F(SpscQueueTest, StressBatches) {
+  constexpr int64_t kCount = 1 << 20;
+  s21::spsc_queue<int64_t> q(256);
+  std::thread producer([&q] {
+    std::vector<int64_t> batch(100);
+    int64_t next = 0;
+    while (next < kCount) {
+      size_t n = std::min<int64_t>(1 + next % 100, kCount - next);
+      for (size_t i = 0; i < n; ++i) {
+        batch[i] = next + i;
+      }
+      size_t pushed = q.try_push_n(batch.data(), n);
+      next += pushed;
+      if (pushed == 0) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<int64_t> batch(77);
+  int64_t expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    size_t n = q.try_pop_n(batch.data(), batch.size());
+    for (size_t i = 0; i < n; ++i) {
+      ordered = ordered && batch[i] == expected++;
+    }
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+}
@@ -4,9 +4,13 @@
 
 #include <cstdlib>
 #include <exception>
+#include <memory>
 #include <stack>
 #include <vector>
 
+#include "s21_list.h"
+#include "s21_vector.h"
+
 class StackTest : public ::testing::Test {
  protected:
   void SetUp(void) override { srand(1); }
@@ -277,3 +281,57 @@ TEST_F(StackTest, InsertManyFront) {
     StacksEqual(st, std_st);
   }
 }
+
+TEST_F(StackTest, Containers) {
+  s21::stack<int, s21::vector<int>> vst(s21::vector<int>{1, 2, 3});
+  s21::stack<int, s21::list<int>> lst;
+  std::stack<int> std_st;
+  std_st.push(1);
+  std_st.push(2);
+  std_st.push(3);
+  for (int i = 0; i < 1000; ++i) {
+    int value = rand();
+    vst.push(value);
+    lst.push(value);
+    std_st.push(value);
+  }
+  lst.insert_many_front(0, 1);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(lst.top(), 1 - i);
+    lst.pop();
+  }
+  EXPECT_EQ(vst.size(), std_st.size());
+  EXPECT_EQ(lst.size(), std_st.size() - 3);
+  while (lst.size() > 0) {
+    EXPECT_EQ(vst.top(), std_st.top());
+    EXPECT_EQ(lst.top(), std_st.top());
+    vst.pop();
+    lst.pop();
+    std_st.pop();
+  }
+  EXPECT_EQ(vst.top(), 3);
+
+  s21::stack<int, s21::vector<int>> copy(vst);
+  s21::stack<int, s21::vector<int>> moved(std::move(vst));
+  EXPECT_TRUE(vst.empty());
+  EXPECT_EQ(moved.size(), copy.size());
+}
+
+TEST_F(StackTest, MoveOnly) {
+  s21::stack<std::unique_ptr<int>> st;
+  s21::stack<std::unique_ptr<int>, s21::list<std::unique_ptr<int>>> lst;
+  st.push(std::make_unique<int>(1));
+  lst.push(std::make_unique<int>(1));
+  EXPECT_EQ(*st.emplace(new int(2)), 2);
+  EXPECT_EQ(*lst.emplace(new int(2)), 2);
+  st.insert_many_front(std::make_unique<int>(3), std::make_unique<int>(4));
+  lst.insert_many_front(std::make_unique<int>(3), std::make_unique<int>(4));
+  EXPECT_EQ(st.size(), 4U);
+  EXPECT_EQ(lst.size(), 4U);
+  for (int i = 4; i > 0; --i) {
+    EXPECT_EQ(*st.top(), i);
+    EXPECT_EQ(*lst.top(), i);
+    st.pop();
+    lst.pop();
+  }
+}
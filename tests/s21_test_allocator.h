@@ -0,0 +1,83 @@
+#ifndef TESTS_S21_TEST_ALLOCATOR_H_
+#define TESTS_S21_TEST_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace s21_test {
+
+/*
+ *  Statistics shared by all copies of a CountingAllocator.
+ */
+struct AllocatorStats {
+  size_t allocations = 0;
+  size_t deallocations = 0;
+  size_t live_bytes = 0;
+  // Larger allocations throw std::bad_alloc.
+  size_t max_bytes = static_cast<size_t>(-1);
+};
+
+/*
+ *  A stateful allocator that counts allocations in the given stats.
+ *  It has no default constructor and allocators with different stats
+ *  are unequal, so containers must carry it around and never mix memory
+ *  of two allocators. Propagate sets all three propagation traits.
+ */
+template <typename T, bool Propagate = false>
+class CountingAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment =
+      std::integral_constant<bool, Propagate>;
+  using propagate_on_container_move_assignment =
+      std::integral_constant<bool, Propagate>;
+  using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+  template <typename U>
+  struct rebind {
+    using other = CountingAllocator<U, Propagate>;
+  };
+
+  explicit CountingAllocator(AllocatorStats *stats) : stats_(stats) {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U, Propagate> &other)
+      : stats_(other.stats()) {}
+
+  T *allocate(size_t n) {
+    if (n * sizeof(T) > stats_->max_bytes) {
+      throw std::bad_alloc();
+    }
+    ++stats_->allocations;
+    stats_->live_bytes += n * sizeof(T);
+    return static_cast<T *>(operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, size_t n) {
+    ++stats_->deallocations;
+    stats_->live_bytes -= n * sizeof(T);
+    operator delete(static_cast<void *>(ptr));
+  }
+
+  AllocatorStats *stats(void) const { return stats_; }
+
+ private:
+  AllocatorStats *stats_;
+};
+
+template <typename T, typename U, bool Propagate>
+bool operator==(const CountingAllocator<T, Propagate> &lhs,
+                const CountingAllocator<U, Propagate> &rhs) {
+  return lhs.stats() == rhs.stats();
+}
+
+template <typename T, typename U, bool Propagate>
+bool operator!=(const CountingAllocator<T, Propagate> &lhs,
+                const CountingAllocator<U, Propagate> &rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace s21_test
+
+#endif  // TESTS_S21_TEST_ALLOCATOR_H_
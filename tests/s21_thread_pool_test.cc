@@ -0,0 +1,110 @@
+#include "s21_thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+#include "s21_vector.h"
+
+class ThreadPoolTest : public ::testing::Test {
+ protected:
+  static int64_t Fib(s21::thread_pool &pool, int n) {
+    if (n < 2) {
+      return n;
+    }
+    int64_t a = 0;
+    int64_t b = 0;
+    pool.parallel_invoke([&] { a = Fib(pool, n - 1); },
+                         [&] { b = Fib(pool, n - 2); });
+    return a + b;
+  }
+
+  static int64_t Sum(s21::thread_pool &pool, const int64_t *first,
+                     const int64_t *last) {
+    if (last - first <= 1024) {
+      int64_t sum = 0;
+      for (; first != last; ++first) {
+        sum += *first;
+      }
+      return sum;
+    }
+    const int64_t *middle = first + (last - first) / 2;
+    int64_t left = 0;
+    int64_t right = 0;
+    pool.parallel_invoke([&] { left = Sum(pool, first, middle); },
+                         [&] { right = Sum(pool, middle, last); });
+    return left + right;
+  }
+};
+
+TEST_F(ThreadPoolTest, SpawnWait) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.size(), 4U);
+  EXPECT_EQ(s21::thread_pool(0).size(), 1U);
+  EXPECT_GE(s21::thread_pool::default_threads(), 1U);
+
+  std::atomic<int> count(0);
+  for (int i = 0; i < 5000; ++i) {
+    pool.spawn([&count] { ++count; });
+  }
+  pool.wait();
+  EXPECT_EQ(count, 5000);
+
+  // Tasks that spawn more tasks from the workers.
+  for (int i = 0; i < 100; ++i) {
+    pool.spawn([&pool, &count] {
+      for (int j = 0; j < 10; ++j) {
+        pool.spawn([&count] { ++count; });
+      }
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(count, 6000);
+}
+
+TEST_F(ThreadPoolTest, ParallelInvoke) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(Fib(pool, 22), 17711);
+
+  int a = 0;
+  int b = 0;
+  int c = 0;
+  pool.parallel_invoke([&a] { a = 1; }, [&b] { b = 2; }, [&c] { c = 3; });
+  EXPECT_EQ(a + b + c, 6);
+
+  s21::vector<int64_t> values(1 << 18);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i;
+  }
+  int64_t n = values.size();
+  EXPECT_EQ(Sum(pool, values.data(), values.data() + n), n * (n - 1) / 2);
+}
+
+TEST_F(ThreadPoolTest, NestedInSpawn) {
+  s21::thread_pool pool(2);
+  std::atomic<int64_t> total(0);
+  for (int i = 0; i < 8; ++i) {
+    pool.spawn([&pool, &total] { total += Fib(pool, 15); });
+  }
+  pool.wait();
+  EXPECT_EQ(total, 8 * 610);
+}
+
+TEST_F(ThreadPoolTest, Exceptions) {
+  s21::thread_pool pool(2);
+  std::atomic<int> finished(0);
+  EXPECT_THROW(pool.parallel_invoke([&finished] { ++finished; },
+                                    [] { throw std::runtime_error("b"); },
+                                    [&finished] { ++finished; }),
+               std::runtime_error);
+  EXPECT_EQ(finished, 2);
+  try {
+    pool.parallel_invoke([] { throw std::logic_error("a"); },
+                         [] { throw std::runtime_error("b"); });
+    FAIL();
+  } catch (const std::logic_error &) {
+  }
+  EXPECT_EQ(Fib(pool, 10), 55);
+}
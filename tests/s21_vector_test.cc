@@ -4,12 +4,23 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include "s21_mmap_allocator.h"
+#include "s21_test_allocator.h"
+
 class VectorTest : public ::testing::Test {
  public:
-  void SetUp(void) override { ErrorClass::count = 0; }
+  void SetUp(void) override {
+    ErrorClass::count = 0;
+    CopyCounter::copies = 0;
+  }
 
   template <typename T>
   bool VectorEqual(const s21::vector<T> &lhs, const s21::vector<T> &rhs) {
@@ -72,9 +83,23 @@ class VectorTest : public ::testing::Test {
    private:
     int *num_;
   };
+
+  class CopyCounter {
+   public:
+    static int copies;
+    CopyCounter(void) {}
+    CopyCounter(const CopyCounter &) { ++copies; }
+    CopyCounter(CopyCounter &&) noexcept {}
+    CopyCounter &operator=(const CopyCounter &) {
+      ++copies;
+      return *this;
+    }
+    CopyCounter &operator=(CopyCounter &&) noexcept { return *this; }
+  };
 };
 
 int VectorTest::ErrorClass::count = 0;
+int VectorTest::CopyCounter::copies = 0;
 
 TEST_F(VectorTest, DefaultCtor) {
   {
@@ -1174,3 +1199,487 @@ TEST_F(VectorTest, ErrorTest10) {
     EXPECT_TRUE(true);
   }
 }
+
+TEST_F(VectorTest, RelocationMovesNoexceptValues) {
+  s21::vector<CopyCounter> v;
+  CopyCounter value;
+  for (int i = 0; i < 1000; ++i) {
+    v.push_back(value);
+  }
+  EXPECT_EQ(CopyCounter::copies, 1000);
+
+  v.reserve(5000);
+  v.shrink_to_fit();
+  EXPECT_EQ(CopyCounter::copies, 1000);
+
+  for (int i = 0; i < 100; ++i) {
+    v.insert(v.begin() + v.size() / 2, value);
+    v.erase(v.begin());
+  }
+  EXPECT_EQ(CopyCounter::copies, 1100);
+}
+
+TEST_F(VectorTest, InsertAliasedValue) {
+  s21::vector<std::string> s21_vec = {"a", "b", "c", "d"};
+  std::vector<std::string> std_vec = {"a", "b", "c", "d"};
+
+  s21_vec.insert(s21_vec.begin(), s21_vec.back());
+  std_vec.insert(std_vec.begin(), std_vec.back());
+  EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin()));
+
+  s21_vec.reserve(100);
+  std_vec.reserve(100);
+  s21_vec.insert(s21_vec.begin() + 1, s21_vec.back());
+  std_vec.insert(std_vec.begin() + 1, std_vec.back());
+  s21_vec.push_back(s21_vec.front());
+  std_vec.push_back(std_vec.front());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+}
+
+TEST_F(VectorTest, MoveOnlyValues) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  v.insert(v.begin(), std::make_unique<int>(-1));
+  v.emplace(v.begin() + 50, new int(-2));
+  v.emplace_back(new int(100));
+  v.erase(v.begin() + 1);
+  v.insert_many(v.begin(), std::make_unique<int>(-3),
+                std::make_unique<int>(-4));
+  v.insert_many_back(std::make_unique<int>(101));
+
+  ASSERT_EQ(v.size(), 105U);
+  EXPECT_EQ(*v[0], -3);
+  EXPECT_EQ(*v[1], -4);
+  EXPECT_EQ(*v[2], -1);
+  EXPECT_EQ(*v[3], 1);
+  EXPECT_EQ(*v[51], -2);
+  EXPECT_EQ(*v[103], 100);
+  EXPECT_EQ(*v[104], 101);
+}
+
+TEST_F(VectorTest, Emplace) {
+  s21::vector<std::pair<int, std::string>> s21_vec;
+  std::vector<std::pair<int, std::string>> std_vec;
+
+  for (int i = 0; i < 1000; ++i) {
+    auto &s21_ref = s21_vec.emplace_back(i, std::to_string(i));
+    auto &std_ref = std_vec.emplace_back(i, std::to_string(i));
+    EXPECT_EQ(s21_ref, std_ref);
+  }
+  for (int i = 0; i < 100; ++i) {
+    auto s21_it = s21_vec.emplace(s21_vec.begin() + i * 3, i, "x");
+    auto std_it = std_vec.emplace(std_vec.begin() + i * 3, i, "x");
+    EXPECT_EQ(*s21_it, *std_it);
+  }
+  s21_vec.emplace(s21_vec.begin(), s21_vec.back());
+  std_vec.emplace(std_vec.begin(), std_vec.back());
+
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+}
+
+TEST_F(VectorTest, PushBackRvalue) {
+  s21::vector<std::string> s21_vec;
+  std::string value(100, 'a');
+  const char *buffer = value.data();
+
+  s21_vec.reserve(1);
+  s21_vec.push_back(std::move(value));
+  EXPECT_EQ(s21_vec[0].data(), buffer);
+
+  std::string other(100, 'b');
+  buffer = other.data();
+  s21_vec.insert(s21_vec.begin(), std::move(other));
+  EXPECT_EQ(s21_vec[0].data(), buffer);
+  EXPECT_EQ(s21_vec[1], std::string(100, 'a'));
+}
+
+TEST_F(VectorTest, InsertCount) {
+  for (size_t pos : {0, 3, 7, 10}) {
+    for (size_t count : {0, 1, 2, 5, 20}) {
+      s21::vector<std::string> s21_vec;
+      std::vector<std::string> std_vec;
+      s21_vec.reserve(16);
+      std_vec.reserve(16);
+      for (int i = 0; i < 10; ++i) {
+        s21_vec.push_back(std::to_string(i));
+        std_vec.push_back(std::to_string(i));
+      }
+
+      auto s21_it = s21_vec.insert(s21_vec.begin() + pos, count, "v");
+      auto std_it = std_vec.insert(std_vec.begin() + pos, count, "v");
+
+      EXPECT_EQ(s21_it - s21_vec.begin(), std_it - std_vec.begin());
+      EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+    }
+  }
+}
+
+TEST_F(VectorTest, InsertRange) {
+  const std::list<std::string> source = {"a", "b", "c", "d", "e", "f", "g"};
+  for (size_t pos : {0, 2, 5}) {
+    s21::vector<std::string> s21_vec = {"0", "1", "2", "3", "4"};
+    std::vector<std::string> std_vec = {"0", "1", "2", "3", "4"};
+
+    auto s21_it =
+        s21_vec.insert(s21_vec.begin() + pos, source.begin(), source.end());
+    auto std_it =
+        std_vec.insert(std_vec.begin() + pos, source.begin(), source.end());
+    EXPECT_EQ(s21_it - s21_vec.begin(), std_it - std_vec.begin());
+    EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+    s21_it = s21_vec.insert(s21_vec.begin() + pos, source.begin(),
+                            std::next(source.begin(), 3));
+    std_it = std_vec.insert(std_vec.begin() + pos, source.begin(),
+                            std::next(source.begin(), 3));
+    EXPECT_EQ(s21_it - s21_vec.begin(), std_it - std_vec.begin());
+    EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  }
+
+  s21::vector<int> v = {1, 2, 3};
+  std::istringstream input("7 8 9");
+  v.insert(v.begin() + 1, std::istream_iterator<int>(input),
+           std::istream_iterator<int>());
+  std::vector<int> expected = {1, 7, 8, 9, 2, 3};
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_EQ(v.size(), expected.size());
+
+  v.insert(v.begin(), 2, 5);
+  EXPECT_EQ(v.size(), 8U);
+  EXPECT_EQ(v[1], 5);
+}
+
+TEST_F(VectorTest, InsertManyInPlace) {
+  s21::vector<std::string> s21_vec = {"0", "1", "2", "3", "4", "5"};
+  std::vector<std::string> std_vec = {"0", "1", "2", "3", "4", "5"};
+  s21_vec.reserve(32);
+  std_vec.reserve(32);
+  std::string value = "s";
+
+  auto it = s21_vec.insert_many(s21_vec.begin() + 1, "a", value, "c");
+  std_vec.insert(std_vec.begin() + 1, {"a", value, "c"});
+  EXPECT_EQ(*it, "1");
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  it = s21_vec.insert_many(s21_vec.end() - 2, "d", "e", "f", "g", "h");
+  std_vec.insert(std_vec.end() - 2, {"d", "e", "f", "g", "h"});
+  EXPECT_EQ(*it, "4");
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21_vec.insert_many(s21_vec.begin());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+}
+
+TEST_F(VectorTest, InsertManyError) {
+  s21::vector<ErrorClass> v(10);
+  v.reserve(200);
+  ErrorClass::count = 99;
+  EXPECT_ANY_THROW(v.insert_many(v.begin() + 2, 1, 2, 3));
+  EXPECT_EQ(v.size(), 10U);
+  EXPECT_ANY_THROW(v.insert(v.begin() + 9, 5, ErrorClass()));
+  EXPECT_EQ(v.size(), 10U);
+  ErrorClass::count = 0;
+  v.insert_many(v.begin() + 9, 1, 2, 3);
+  EXPECT_EQ(v.size(), 13U);
+}
+
+TEST_F(VectorTest, TriviallyCopyableValues) {
+  struct Point {
+    int x;
+    double y;
+    bool operator==(const Point &other) const {
+      return x == other.x && y == other.y;
+    }
+  };
+
+  s21::vector<Point> s21_vec;
+  std::vector<Point> std_vec;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vec.push_back({i, i * 0.5});
+    std_vec.push_back({i, i * 0.5});
+  }
+  for (int i = 0; i < 100; ++i) {
+    s21_vec.insert(s21_vec.begin() + i * 7, {-i, 1.0});
+    std_vec.insert(std_vec.begin() + i * 7, {-i, 1.0});
+    s21_vec.erase(s21_vec.begin() + i * 3);
+    std_vec.erase(std_vec.begin() + i * 3);
+  }
+  s21_vec.insert_many(s21_vec.begin() + 10, Point{1, 1}, Point{2, 2});
+  std_vec.insert(std_vec.begin() + 10, {Point{1, 1}, Point{2, 2}});
+  s21_vec.insert(s21_vec.begin() + 500, 40, Point{3, 3});
+  std_vec.insert(std_vec.begin() + 500, 40, Point{3, 3});
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21::vector<Point> s21_copy(s21_vec);
+  std::vector<Point> std_copy(std_vec);
+  s21_copy.shrink_to_fit();
+  std_copy.shrink_to_fit();
+  EXPECT_TRUE(VectorEqual(s21_copy, std_copy));
+
+  s21::vector<unsigned long> zeros(1000);
+  EXPECT_TRUE(std::all_of(zeros.begin(), zeros.end(),
+                          [](unsigned long value) { return value == 0; }));
+  s21::vector<unsigned long> values(10);
+  values.insert(values.begin() + 5, 3, 0xdeadbeefUL);
+  EXPECT_EQ(values[4], 0UL);
+  EXPECT_EQ(values[5], 0xdeadbeefUL);
+  EXPECT_EQ(values[7], 0xdeadbeefUL);
+  EXPECT_EQ(values[8], 0UL);
+  zeros = values;
+  EXPECT_TRUE(std::equal(zeros.begin(), zeros.end(), values.begin()));
+}
+
+TEST_F(VectorTest, StatefulAllocator) {
+  using Alloc = s21_test::CountingAllocator<std::string>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::vector<std::string, Alloc> v{Alloc(&stats)};
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(std::to_string(i));
+    }
+    v.insert(v.begin() + 50, 10, "x");
+    v.insert_many(v.begin(), "a", "b", "c");
+    v.shrink_to_fit();
+    EXPECT_EQ(v.size(), 113U);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[53], "x");
+    EXPECT_EQ(v.get_allocator(), Alloc(&stats));
+    EXPECT_GT(stats.allocations, 0U);
+    EXPECT_EQ(stats.live_bytes, v.capacity() * sizeof(std::string));
+
+    s21::vector<std::string, Alloc> copy(v);
+    EXPECT_EQ(copy.get_allocator(), Alloc(&stats));
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), copy.begin()));
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+TEST_F(VectorTest, AllocatorPropagation) {
+  s21_test::AllocatorStats stats1;
+  s21_test::AllocatorStats stats2;
+  {
+    using Alloc = s21_test::CountingAllocator<int>;
+    s21::vector<int, Alloc> v1({1, 2, 3}, Alloc(&stats1));
+    s21::vector<int, Alloc> v2({4, 5}, Alloc(&stats2));
+
+    // Unequal allocators that don't propagate: the values are moved
+    // into the storage of the destination.
+    v2 = std::move(v1);
+    EXPECT_EQ(v2.get_allocator(), Alloc(&stats2));
+    EXPECT_EQ(v2.size(), 3U);
+    EXPECT_EQ(v2[2], 3);
+    EXPECT_TRUE(v1.empty());
+    v1 = v2;
+    EXPECT_EQ(v1.get_allocator(), Alloc(&stats1));
+    EXPECT_EQ(v1[0], 1);
+
+    s21::vector<int, Alloc> v3(std::move(v2), Alloc(&stats1));
+    EXPECT_EQ(v3.get_allocator(), Alloc(&stats1));
+    EXPECT_EQ(v3.size(), 3U);
+  }
+  {
+    using Alloc = s21_test::CountingAllocator<int, true>;
+    s21::vector<int, Alloc> v1({1, 2, 3}, Alloc(&stats1));
+    s21::vector<int, Alloc> v2({4, 5}, Alloc(&stats2));
+
+    v2 = v1;
+    EXPECT_EQ(v2.get_allocator(), Alloc(&stats1));
+    v1.swap(v2);
+    v2 = std::move(v1);
+    EXPECT_EQ(v2.get_allocator(), Alloc(&stats1));
+    EXPECT_EQ(v2.size(), 3U);
+  }
+  EXPECT_EQ(stats1.allocations, stats1.deallocations);
+  EXPECT_EQ(stats2.allocations, stats2.deallocations);
+  EXPECT_EQ(stats1.live_bytes + stats2.live_bytes, 0U);
+}
+
+TEST_F(VectorTest, GrowthPolicies) {
+  s21::vector<int, std::allocator<int>, s21::OneAndHalfGrowth> half;
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 100; ++i) {
+    if (half.size() == half.capacity()) {
+      capacities.push_back(half.size() + std::max<size_t>(half.size() / 2, 1));
+    }
+    half.push_back(i);
+    EXPECT_EQ(half.capacity(), capacities.back());
+  }
+  EXPECT_EQ(half.capacity(), 141U);
+  EXPECT_EQ(half.slack_bytes(), 41 * sizeof(int));
+  half.insert(half.begin(), 100, 0);
+  EXPECT_EQ(half.capacity(), 200U);
+
+  s21::vector<int, std::allocator<int>, s21::JemallocGrowth> rounded;
+  rounded.push_back(1);
+  EXPECT_EQ(rounded.capacity(), 2U);  // 8 bytes is the smallest class
+  rounded.reserve(33);                // 132 bytes are rounded to 160
+  EXPECT_EQ(rounded.capacity(), 40U);
+  for (int i = 1; i < 40; ++i) {
+    rounded.push_back(i);
+  }
+  rounded.push_back(40);  // 60 cells need 240 bytes, rounded to 256
+  EXPECT_EQ(rounded.capacity(), 64U);
+  EXPECT_EQ(rounded.slack_bytes(), 23 * sizeof(int));
+  rounded.shrink_to_fit();  // 164 bytes are rounded to 192
+  EXPECT_EQ(rounded.capacity(), 48U);
+  EXPECT_EQ(rounded[40], 40);
+
+  s21::vector<int> doubling;
+  EXPECT_EQ(doubling.slack_bytes(), 0U);
+  doubling.push_back(1);
+  doubling.push_back(2);
+  doubling.push_back(3);
+  EXPECT_EQ(doubling.slack_bytes(), sizeof(int));
+}
+
+TEST_F(VectorTest, JemallocSizeClasses) {
+  EXPECT_EQ(s21::JemallocSizeClass(1), 8U);
+  EXPECT_EQ(s21::JemallocSizeClass(9), 16U);
+  EXPECT_EQ(s21::JemallocSizeClass(100), 112U);
+  EXPECT_EQ(s21::JemallocSizeClass(129), 160U);
+  EXPECT_EQ(s21::JemallocSizeClass(256), 256U);
+  EXPECT_EQ(s21::JemallocSizeClass(257), 320U);
+  EXPECT_EQ(s21::JemallocSizeClass(4097), 5120U);
+  EXPECT_EQ(s21::JemallocSizeClass(100000), 114688U);
+  size_t huge = std::numeric_limits<size_t>::max() - 3;
+  EXPECT_EQ(s21::JemallocSizeClass(huge), huge);
+}
+
+TEST_F(VectorTest, Resize) {
+  s21::vector<std::string> s21_vec = {"a", "b", "c"};
+  std::vector<std::string> std_vec = {"a", "b", "c"};
+  s21_vec.resize(2);
+  std_vec.resize(2);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.resize(5);
+  std_vec.resize(5);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.resize(11, s21_vec[0]);
+  std_vec.resize(11, std_vec[0]);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.resize(0, "x");
+  std_vec.resize(0, "x");
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21::vector<int> s21_ints(3);
+  std::vector<int> std_ints(3);
+  s21_ints.resize(4);
+  std_ints.resize(4);
+  EXPECT_TRUE(VectorEqual(s21_ints, std_ints));
+  s21_ints.resize(40, 7);
+  std_ints.resize(40, 7);
+  EXPECT_TRUE(VectorEqual(s21_ints, std_ints));
+
+  s21::vector<ErrorClass> errors(2);
+  ErrorClass::count = 90;
+  EXPECT_ANY_THROW(errors.resize(20));
+  EXPECT_EQ(errors.size(), 2U);
+}
+
+TEST_F(VectorTest, ResizeWithoutInit) {
+  s21::vector<std::string> strings = {"a"};
+  strings.resize_default_init(3);
+  EXPECT_EQ(strings.size(), 3U);
+  EXPECT_EQ(strings[0], "a");
+  EXPECT_TRUE(strings[2].empty());
+  strings.resize_default_init(1);
+  EXPECT_EQ(strings.size(), 1U);
+
+  s21::vector<char> buffer;
+  buffer.resize_uninitialized(100);
+  EXPECT_EQ(buffer.size(), 100U);
+  EXPECT_EQ(buffer.capacity(), 100U);
+  std::fill(buffer.begin(), buffer.end(), 'x');
+  buffer.resize_uninitialized(150);
+  EXPECT_EQ(buffer.capacity(), 200U);
+  EXPECT_TRUE(std::all_of(buffer.begin(), buffer.begin() + 100,
+                          [](char c) { return c == 'x'; }));
+  buffer.resize_uninitialized(10);
+  EXPECT_EQ(buffer.size(), 10U);
+  buffer.resize_default_init(20);
+  EXPECT_EQ(buffer.size(), 20U);
+  EXPECT_EQ(buffer[9], 'x');
+}
+
+TEST_F(VectorTest, EraseRange) {
+  s21::vector<std::string> s21_vec;
+  std::vector<std::string> std_vec;
+  for (int i = 0; i < 50; ++i) {
+    s21_vec.push_back(std::to_string(i));
+    std_vec.push_back(std::to_string(i));
+  }
+  auto s21_it = s21_vec.erase(s21_vec.begin() + 10, s21_vec.begin() + 25);
+  auto std_it = std_vec.erase(std_vec.begin() + 10, std_vec.begin() + 25);
+  EXPECT_EQ(*s21_it, *std_it);
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+  s21_vec.erase(s21_vec.begin(), s21_vec.begin());
+  s21_vec.erase(s21_vec.begin() + 30, s21_vec.end());
+  std_vec.erase(std_vec.begin() + 30, std_vec.end());
+  EXPECT_TRUE(VectorEqual(s21_vec, std_vec));
+
+  s21::vector<int> ints = {1, 2, 3, 4, 5};
+  EXPECT_EQ(*ints.erase(ints.begin(), ints.begin() + 2), 3);
+  auto it = ints.erase(ints.begin(), ints.end());
+  EXPECT_EQ(it, ints.end());
+  EXPECT_TRUE(ints.empty());
+}
+
+TEST_F(VectorTest, EraseIf) {
+  s21::vector<std::string> s21_vec;
+  std::vector<std::string> std_vec;
+  for (int i = 0; i < 100; ++i) {
+    s21_vec.push_back(std::to_string(i));
+    if (i % 3 != 0) {
+      std_vec.push_back(std::to_string(i));
+    }
+  }
+  size_t count = s21::erase_if(
+      s21_vec, [](const std::string &x) { return std::stoi(x) % 3 == 0; });
+  EXPECT_EQ(count, 34U);
+  EXPECT_EQ(s21_vec.size(), std_vec.size());
+  EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin()));
+
+  s21::vector<int> ints(1000);
+  EXPECT_EQ(s21::erase_if(ints, [](int x) { return x == 0; }), 1000U);
+  EXPECT_TRUE(ints.empty());
+}
+
+TEST_F(VectorTest, MmapAllocator) {
+  using Vector = s21::vector<uint64_t, s21::mmap_allocator<uint64_t>>;
+  const size_t count = 1 << 19;
+  Vector v;
+  for (size_t i = 0; i < count; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v.size(), count);
+  EXPECT_EQ(v.capacity(), count);
+  v.push_back(v[7]);
+  v.insert(v.begin(), v[count - 1]);
+  v.reserve(4 * count);
+  EXPECT_EQ(v.capacity(), 4 * count);
+  v.resize(3 * count, v[1]);
+  v.resize(4 * count);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 4 * count);
+  EXPECT_EQ(v[0], count - 1);
+  EXPECT_EQ(v[count + 1], 7U);
+  EXPECT_EQ(v[count + 2], 0U);
+  EXPECT_EQ(v[3 * count], 0U);
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(v[i + 1], i);
+  }
+  v.resize(16);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 16U);
+  EXPECT_EQ(v[15], 14U);
+
+  s21::vector<std::string, s21::mmap_allocator<std::string, true>> strings;
+  for (size_t i = 0; i < count / 4; ++i) {
+    strings.push_back(std::to_string(i));
+  }
+  strings.shrink_to_fit();
+  EXPECT_EQ(strings.size(), count / 4);
+  EXPECT_EQ(strings.back(), std::to_string(count / 4 - 1));
+}
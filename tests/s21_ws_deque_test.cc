@@ -0,0 +1,119 @@
+#include "s21_ws_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "s21_test_allocator.h"
+
+class WsDequeTest : public ::testing::Test {};
+
+TEST_F(WsDequeTest, OwnerPopsNewestFirst) {
+  s21::ws_deque<int> deque(3);
+  EXPECT_EQ(deque.capacity(), 4U);
+  EXPECT_TRUE(deque.empty());
+  int out = -1;
+  EXPECT_FALSE(deque.try_pop(out));
+  EXPECT_FALSE(deque.try_steal(out));
+  EXPECT_EQ(out, -1);
+
+  for (int i = 0; i < 100; ++i) {
+    deque.push(i);
+  }
+  EXPECT_EQ(deque.size(), 100U);
+  EXPECT_EQ(deque.capacity(), 128U);
+  for (int i = 99; i >= 0; --i) {
+    ASSERT_TRUE(deque.try_pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_FALSE(deque.try_pop(out));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WsDequeTest, ThievesTakeOldestFirst) {
+  s21::ws_deque<int> deque(2);
+  int out = -1;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 10; ++i) {
+      deque.push(i);
+    }
+    ASSERT_TRUE(deque.try_steal(out));
+    EXPECT_EQ(out, 0);
+    ASSERT_TRUE(deque.try_pop(out));
+    EXPECT_EQ(out, 9);
+    for (int i = 1; i < 9; ++i) {
+      ASSERT_TRUE(deque.try_steal(out));
+      EXPECT_EQ(out, i);
+    }
+    EXPECT_FALSE(deque.try_steal(out));
+    EXPECT_FALSE(deque.try_pop(out));
+  }
+}
+
+TEST_F(WsDequeTest, ReleasesArrays) {
+  using Alloc = s21_test::CountingAllocator<int *>;
+  s21_test::AllocatorStats stats;
+  {
+    s21::ws_deque<int *, Alloc> deque(1, Alloc(&stats));
+    for (int i = 0; i < 64; ++i) {
+      deque.push(nullptr);
+    }
+    EXPECT_GT(stats.allocations, 2U);
+  }
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+  EXPECT_EQ(stats.live_bytes, 0U);
+}
+
+/*
+ *  The owner pushes values and pops some of them while thieves steal.
+ *  Every value must be taken exactly once.
+ */
+TEST_F(WsDequeTest, StressSteal) {
+  constexpr int kThieves = 3;
+  constexpr int64_t kValues = 1 << 17;
+  s21::ws_deque<int64_t> deque(2);
+  std::atomic<bool> done(false);
+  std::vector<int64_t> sums(kThieves + 1, 0);
+  std::vector<int64_t> counts(kThieves + 1, 0);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([t, &deque, &done, &sums, &counts] {
+      int64_t value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.try_steal(value)) {
+          sums[t] += value;
+          ++counts[t];
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int64_t value;
+  for (int64_t i = 0; i < kValues; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.try_pop(value)) {
+      sums[kThieves] += value;
+      ++counts[kThieves];
+    }
+  }
+  while (deque.try_pop(value)) {
+    sums[kThieves] += value;
+    ++counts[kThieves];
+  }
+  done = true;
+  for (std::thread &thread : thieves) {
+    thread.join();
+  }
+  int64_t total = 0;
+  int64_t taken = 0;
+  for (int t = 0; t <= kThieves; ++t) {
+    total += sums[t];
+    taken += counts[t];
+  }
+  EXPECT_EQ(taken, kValues);
+  EXPECT_EQ(total, kValues * (kValues - 1) / 2);
+}